@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "benchmark/read_scaling.hpp"
+#include "src/data_structure/concurrent_hash_map.hpp"
+
+using namespace nyx::data_structure;
+using nyx::bench::all_cores;
+using nyx::bench::SharedFixture;
+
+namespace {
+constexpr std::size_t kKeys = 1 << 20;
+
+// The external lock workers need around a std::unordered_map today
+class LockedMap {
+  mutable std::shared_mutex mutex_;
+  std::unordered_map<std::size_t, std::size_t> map_;
+
+ public:
+  std::optional<std::size_t> find(std::size_t key) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = map_.find(key);
+    return it == map_.end() ? std::nullopt : std::optional<std::size_t>(it->second);
+  }
+  void insert_or_assign(std::size_t key, std::size_t value) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    map_.insert_or_assign(key, value);
+  }
+};
+
+std::size_t next_key(std::uint64_t& state) {
+  // xorshift, cheap enough not to hide the lookup
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state & (kKeys - 1);
+}
+}  // namespace
+
+// range(0) out of 100 operations are writes, the rest are lookups of present keys
+template <typename Map>
+static void BM_ReadMostly(::benchmark::State& state) {
+  SharedFixture<Map> map(state, [](Map& shared) {
+    for (std::size_t key = 0; key < kKeys; ++key) {
+      shared.insert_or_assign(key, key);
+    }
+  });
+
+  auto writes = state.range(0);
+  std::uint64_t rng = 0x9E3779B97F4A7C15ULL * (state.thread_index() + 1);
+  std::size_t op = 0;
+  for (auto _ : state) {
+    auto key = next_key(rng);
+    if (static_cast<std::int64_t>(op++ % 100) < writes) {
+      map->insert_or_assign(key, op);
+    } else {
+      ::benchmark::DoNotOptimize(map->find(key));
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ReadMostly<LockedMap>)->Arg(0)->Arg(10)->Apply(all_cores);
+BENCHMARK(BM_ReadMostly<ConcurrentHashMap<std::size_t, std::size_t>>)->Arg(0)->Arg(10)->Apply(all_cores);
+
+BENCHMARK_MAIN();
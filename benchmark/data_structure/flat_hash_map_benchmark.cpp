@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "src/data_structure/flat_hash_map.hpp"
+
+using namespace nyx::data_structure;
+
+namespace {
+// Random keys, so that neither table benefits from std::hash being the identity
+std::vector<std::uint64_t> random_keys(std::size_t count, std::uint64_t seed) {
+  std::mt19937_64 gen(seed);
+  std::vector<std::uint64_t> keys(count);
+  for (auto& key : keys) {
+    key = gen();
+  }
+  return keys;
+}
+
+template <typename Map>
+Map build(const std::vector<std::uint64_t>& keys) {
+  Map map;
+  for (auto key : keys) {
+    map[key] = key;
+  }
+  return map;
+}
+}  // namespace
+
+// Inserts range(0) keys into an empty map, growing it on the way
+template <typename Map>
+static void BM_Insert(::benchmark::State& state) {
+  auto keys = random_keys(state.range(0), 1);
+  for (auto _ : state) {
+    Map map;
+    for (auto key : keys) {
+      map[key] = key;
+    }
+    ::benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Map>
+static void BM_FindHit(::benchmark::State& state) {
+  auto keys = random_keys(state.range(0), 1);
+  auto map = build<Map>(keys);
+  // Probe in a different order than insertion
+  auto probes = keys;
+  std::shuffle(probes.begin(), probes.end(), std::mt19937_64(2));
+
+  std::size_t i = 0;
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(map.find(probes[i])->second);
+    i = i + 1 == probes.size() ? 0 : i + 1;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Map>
+static void BM_FindMiss(::benchmark::State& state) {
+  auto map = build<Map>(random_keys(state.range(0), 1));
+  auto probes = random_keys(state.range(0), 3);
+
+  std::size_t i = 0;
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(map.find(probes[i]) == map.end());
+    i = i + 1 == probes.size() ? 0 : i + 1;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Steady state of a map whose size stays constant: erase one key, insert another
+template <typename Map>
+static void BM_EraseInsert(::benchmark::State& state) {
+  auto keys = random_keys(state.range(0) * 2, 1);
+  std::vector<std::uint64_t> live(keys.begin(), keys.begin() + state.range(0));
+  auto map = build<Map>(live);
+
+  std::size_t i = 0, next = state.range(0);
+  for (auto _ : state) {
+    map.erase(live[i]);
+    live[i] = keys[next];
+    map[live[i]] = i;
+    i = i + 1 == live.size() ? 0 : i + 1;
+    next = next + 1 == keys.size() ? 0 : next + 1;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+using StdMap = std::unordered_map<std::uint64_t, std::uint64_t>;
+using FlatMap = FlatHashMap<std::uint64_t, std::uint64_t>;
+
+BENCHMARK(BM_Insert<StdMap>)->RangeMultiplier(10)->Range(1'000, 10'000'000)->Unit(::benchmark::kMillisecond);
+BENCHMARK(BM_Insert<FlatMap>)->RangeMultiplier(10)->Range(1'000, 10'000'000)->Unit(::benchmark::kMillisecond);
+BENCHMARK(BM_FindHit<StdMap>)->RangeMultiplier(10)->Range(1'000, 10'000'000);
+BENCHMARK(BM_FindHit<FlatMap>)->RangeMultiplier(10)->Range(1'000, 10'000'000);
+BENCHMARK(BM_FindMiss<StdMap>)->RangeMultiplier(10)->Range(1'000, 10'000'000);
+BENCHMARK(BM_FindMiss<FlatMap>)->RangeMultiplier(10)->Range(1'000, 10'000'000);
+BENCHMARK(BM_EraseInsert<StdMap>)->RangeMultiplier(10)->Range(1'000, 10'000'000);
+BENCHMARK(BM_EraseInsert<FlatMap>)->RangeMultiplier(10)->Range(1'000, 10'000'000);
+
+BENCHMARK_MAIN();
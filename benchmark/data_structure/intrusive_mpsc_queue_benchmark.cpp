@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "src/data_structure/intrusive_mpsc_queue.hpp"
+#include "src/data_structure/scsp_mutex_queue.hpp"
+
+using namespace nyx::data_structure;
+
+namespace {
+constexpr std::size_t kMessagesPerProducer = 1 << 14;
+
+struct Message : MpscHook<> {
+  std::uint64_t payload{0};
+};
+
+// What worker inboxes use today: a bounded ring behind one mutex, producers retry while it is full
+class MutexInbox {
+  ScspMutexQueue<Message*> queue_{1 << 16};
+
+ public:
+  void push(Message* message) {
+    while (!queue_.push(message)) {
+      std::this_thread::yield();
+    }
+  }
+  Message* pop() {
+    Message* message = nullptr;
+    return queue_.pop_front(&message) ? message : nullptr;
+  }
+};
+
+class IntrusiveInbox {
+  IntrusiveMpscQueue<Message> queue_;
+
+ public:
+  void push(Message* message) { queue_.push(message); }
+  Message* pop() { return queue_.pop(); }
+};
+}  // namespace
+
+// range(0) producers hand kMessagesPerProducer messages each to a single consumer, timed from the start
+// signal until the consumer drained everything.
+template <typename Inbox>
+static void BM_MpscHandoff(::benchmark::State& state) {
+  const auto producers = static_cast<std::size_t>(state.range(0));
+  const auto total = producers * kMessagesPerProducer;
+  std::vector<std::unique_ptr<Message[]>> messages;
+  for (std::size_t p = 0; p < producers; ++p) {
+    messages.push_back(std::make_unique<Message[]>(kMessagesPerProducer));
+  }
+
+  for (auto _ : state) {
+    Inbox inbox;
+    std::atomic<bool> start{false};
+    std::vector<std::thread> threads;
+    for (std::size_t p = 0; p < producers; ++p) {
+      threads.emplace_back([&, p] {
+        while (!start.load(std::memory_order_acquire)) {
+          std::this_thread::yield();
+        }
+        for (std::size_t i = 0; i < kMessagesPerProducer; ++i) {
+          messages[p][i].payload = i;
+          inbox.push(&messages[p][i]);
+        }
+      });
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    std::uint64_t sum = 0;
+    for (std::size_t received = 0; received < total;) {
+      if (auto* message = inbox.pop(); message != nullptr) {
+        sum += message->payload;
+        ++received;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+    auto end = std::chrono::steady_clock::now();
+    ::benchmark::DoNotOptimize(sum);
+
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    state.SetIterationTime(std::chrono::duration<double>(end - begin).count());
+  }
+  state.SetItemsProcessed(state.iterations() * total);
+}
+BENCHMARK(BM_MpscHandoff<MutexInbox>)->RangeMultiplier(2)->Range(1, 64)->UseManualTime();
+BENCHMARK(BM_MpscHandoff<IntrusiveInbox>)->RangeMultiplier(2)->Range(1, 64)->UseManualTime();
+
+BENCHMARK_MAIN();
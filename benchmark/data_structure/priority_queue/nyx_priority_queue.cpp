@@ -5,6 +5,8 @@
 #include <queue>
 #include <unordered_map>
 
+#include "src/data_structure/flat_priority_queue.hpp"
+#include "src/data_structure/hierarchical_priority_queue.hpp"
 #include "src/data_structure/priority_queue.hpp"
 #include "src/utils/include/rand.hpp"
 
@@ -66,6 +68,36 @@ static void BM_unordered_map(::benchmark::State& state) {
   }
 }
 BENCHMARK(BM_unordered_map)->RangeMultiplier(10)->Range(1'000, 1'000'000)->UseManualTime();
+
+// Push every element, move each one to another level, then drain
+template <typename PriorityQueue>
+static void BM_PushUpdatePop(::benchmark::State& state) {
+  PriorityQueue pq;
+  for (auto _ : state) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < state.range(0); ++i) {
+      size_t x = i;
+      pq.push_no_update(std::move(x), i % 4096);
+    }
+    for (int i = 0; i < state.range(0); ++i) {
+      size_t x = i;
+      pq.push_and_update(std::move(x), (i * 7) % 4096);
+    }
+    size_t out;
+    while (pq.try_pop(out)) {
+      ::benchmark::DoNotOptimize(out);
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    auto elapsed_seconds = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PushUpdatePop<data_structure::hierarchical_priority_queue<size_t>>)->RangeMultiplier(10)->Range(1'000, 1'000'000)->UseManualTime();
+BENCHMARK(BM_PushUpdatePop<data_structure::flat_priority_queue<size_t>>)->RangeMultiplier(10)->Range(1'000, 1'000'000)->UseManualTime();
 }  // namespace nyx::benchmark
 
 BENCHMARK_MAIN();
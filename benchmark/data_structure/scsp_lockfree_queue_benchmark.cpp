@@ -1,6 +1,7 @@
 #include <benchmark/benchmark.h>
 
 #include <mutex>
+#include <vector>
 
 #include "src/data_structure/scsp_lockfree_queue.hpp"
 
@@ -46,4 +47,28 @@ ScspLockFreeQueue<int> ScspLockFreeQueueFixture::queue(1000);
 std::mutex ScspLockFreeQueueFixture::mu;
 
 BENCHMARK_REGISTER_F(ScspLockFreeQueueFixture, ScspLockFreeQueueBenchmark)->Range(1000, 1000000)->Threads(2);
+
+// One producer and one consumer moving batch_size elements per call, single element calls for batch_size == 1.
+static void BM_ScspLockFreeQueueBulk(::benchmark::State& state) {
+  static ScspLockFreeQueue<int> queue(4096);
+
+  const bool is_push_thread = state.thread_index() == 0;
+  const std::size_t batch_size = state.range(0);
+  std::vector<int> buffer(batch_size);
+  std::size_t items = 0;
+
+  if (is_push_thread) {
+    for (auto _ : state) {
+      items += batch_size == 1 ? queue.push(0) : queue.push_bulk(buffer.begin(), buffer.end());
+    }
+  } else {
+    for (auto _ : state) {
+      items += batch_size == 1 ? queue.pop(buffer[0]) : queue.pop_bulk(buffer.begin(), batch_size);
+    }
+  }
+
+  state.SetItemsProcessed(items);
+}
+BENCHMARK(BM_ScspLockFreeQueueBulk)->RangeMultiplier(2)->Range(1, 256)->Threads(2);
+
 BENCHMARK_MAIN();
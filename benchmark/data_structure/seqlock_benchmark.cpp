@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <mutex>
+
+#include "benchmark/read_scaling.hpp"
+#include "src/data_structure/seqlock.hpp"
+
+using namespace nyx::data_structure;
+using nyx::bench::all_cores;
+using nyx::bench::SharedFixture;
+
+namespace {
+// A route table entry sized snapshot
+struct Config {
+  std::uint64_t version;
+  std::uint64_t values[7];
+};
+
+// What read-mostly state uses today, like ServerStream::m_mu
+class LockedConfig {
+  mutable std::mutex mutex_;
+  Config config_{};
+
+ public:
+  Config load() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return config_;
+  }
+  void store(const Config& config) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    config_ = config;
+  }
+};
+
+class SeqlockConfig {
+  Seqlock<Config> config_;
+
+ public:
+  Config load() const { return config_.load(); }
+  void store(const Config& config) { config_.store(config); }
+};
+}  // namespace
+
+// Every thread reads the snapshot, thread 0 also publishes a new one every 4096 reads.
+template <typename Guarded>
+static void BM_ReadMostly(::benchmark::State& state) {
+  SharedFixture<Guarded> guarded(state);
+
+  std::uint64_t reads = 0;
+  for (auto _ : state) {
+    if (state.thread_index() == 0 && (++reads & 4095) == 0) {
+      guarded->store(Config{reads, {}});
+    }
+    ::benchmark::DoNotOptimize(guarded->load());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ReadMostly<LockedConfig>)->Apply(all_cores);
+BENCHMARK(BM_ReadMostly<SeqlockConfig>)->Apply(all_cores);
+
+BENCHMARK_MAIN();
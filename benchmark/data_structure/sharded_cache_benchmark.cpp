@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include "src/data_structure/sharded_cache.hpp"
+#include "src/utils/include/rand.hpp"
+
+using namespace nyx::data_structure;
+
+namespace {
+constexpr std::size_t kKeySpace = 1 << 20;
+constexpr std::size_t kCapacity = kKeySpace / 20;
+constexpr std::size_t kKeysPerThread = 1 << 20;
+
+// Zipf(0.99) keys, generated once per thread index outside of the timed region
+const std::vector<std::size_t>& zipfian_keys(int thread_index) {
+  static std::mutex mu;
+  static std::deque<std::vector<std::size_t>> keys;
+
+  std::lock_guard<std::mutex> lock(mu);
+  while (keys.size() <= static_cast<std::size_t>(thread_index)) {
+    nyx::utils::rand::Zipfian zipfian(kKeySpace, 0.99, keys.size() + 1);
+    auto& list = keys.emplace_back(kKeysPerThread);
+    for (auto& key : list) {
+      // Scatter the hot keys so that they do not all land in the same shard
+      key = (zipfian.next() * 0x9E3779B97F4A7C15ULL) % kKeySpace;
+    }
+  }
+  return keys[thread_index];
+}
+}  // namespace
+
+// Read-through pattern: get, and put on a miss. range(0) is the number of shards.
+template <typename Policy>
+static void BM_ShardedCacheZipfian(::benchmark::State& state) {
+  static ShardedCache<std::size_t, std::size_t, Policy>* cache = nullptr;
+  if (state.thread_index() == 0) {
+    cache = new ShardedCache<std::size_t, std::size_t, Policy>(kCapacity, state.range(0));
+  }
+  const auto& keys = zipfian_keys(state.thread_index());
+
+  std::size_t i = 0;
+  for (auto _ : state) {
+    auto key = keys[i++ & (kKeysPerThread - 1)];
+    if (auto value = cache->get(key)) {
+      ::benchmark::DoNotOptimize(*value);
+    } else {
+      cache->put(key, key);
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+
+  if (state.thread_index() == 0) {
+    auto stats = cache->stats();
+    state.counters["hit_ratio"] = stats.hit_ratio();
+    state.counters["evictions"] = stats.evictions;
+    delete cache;
+  }
+}
+BENCHMARK(BM_ShardedCacheZipfian<cache_policy::Lru>)->Arg(1)->Arg(16)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_ShardedCacheZipfian<cache_policy::S3Fifo>)->Arg(1)->Arg(16)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+
+#include "benchmark/read_scaling.hpp"
+#include "src/data_structure/skiplist.hpp"
+
+using namespace nyx::data_structure;
+using nyx::bench::all_cores;
+using nyx::bench::SharedFixture;
+
+namespace {
+constexpr std::size_t kKeys = 1 << 16;
+
+// What ordered lookups cost today: a std::map behind one mutex
+class LockedMap {
+  mutable std::mutex mutex_;
+  std::map<std::size_t, std::size_t> map_;
+
+ public:
+  bool insert(std::size_t key, std::size_t value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.emplace(key, value).second;
+  }
+  bool erase(std::size_t key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.erase(key) == 1;
+  }
+  // Next key after key, or key when there is none
+  std::size_t next_after(std::size_t key) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = map_.upper_bound(key);
+    return it == map_.end() ? key : it->first;
+  }
+};
+
+class LockFreeMap {
+  SkipListMap<std::size_t, std::size_t> map_;
+
+ public:
+  bool insert(std::size_t key, std::size_t value) { return map_.insert(key, value); }
+  bool erase(std::size_t key) { return map_.erase(key); }
+  std::size_t next_after(std::size_t key) const {
+    auto it = map_.upper_bound(key);
+    return it == map_.end() ? key : it->first;
+  }
+};
+
+std::size_t next_key(std::uint64_t& state) {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state & (kKeys - 1);
+}
+}  // namespace
+
+// range(0) out of 100 operations are writes (an insert or an erase), the rest are "next key after X" queries.
+// Half of the key space is present at any time.
+template <typename Map>
+static void BM_OrderedMixed(::benchmark::State& state) {
+  SharedFixture<Map> map(state, [](Map& shared) {
+    for (std::size_t key = 0; key < kKeys; key += 2) {
+      shared.insert(key, key);
+    }
+  });
+
+  auto writes = state.range(0);
+  std::uint64_t rng = 0x9E3779B97F4A7C15ULL * (state.thread_index() + 1);
+  std::size_t op = 0;
+  for (auto _ : state) {
+    auto key = next_key(rng);
+    auto percent = static_cast<std::int64_t>(op++ % 100);
+    if (percent < writes) {
+      // Alternating erase and insert keeps the size stable
+      ::benchmark::DoNotOptimize(percent % 2 == 0 ? map->erase(key) : map->insert(key, key));
+    } else {
+      ::benchmark::DoNotOptimize(map->next_after(key));
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_OrderedMixed<LockedMap>)->Arg(0)->Arg(10)->Arg(50)->Apply(all_cores);
+BENCHMARK(BM_OrderedMixed<LockFreeMap>)->Arg(0)->Arg(10)->Arg(50)->Apply(all_cores);
+
+BENCHMARK_MAIN();
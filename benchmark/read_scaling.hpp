@@ -0,0 +1,54 @@
+#ifndef BENCHMARK_READ_SCALING_HPP
+#define BENCHMARK_READ_SCALING_HPP
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+
+// Setup shared by the benchmarks that measure how reads scale with the number of threads
+namespace nyx::bench {
+// 1, 2, 4, ... threads up to every core
+inline void all_cores(::benchmark::internal::Benchmark* bench) {
+  auto cores = std::max(1u, std::thread::hardware_concurrency());
+  for (unsigned threads = 1; threads < cores; threads *= 2) {
+    bench->Threads(threads);
+  }
+  bench->Threads(cores)->UseRealTime();
+}
+
+// One T shared by every thread of a benchmark run. Thread 0 creates it before the timed loop and destroys it
+// after, the other threads only use it inside the loop: google benchmark starts and ends the loop of all
+// threads together, so none of them sees it half built or already gone.
+template <typename T>
+class SharedFixture {
+  static inline T* instance_ = nullptr;
+  bool owner_;
+
+ public:
+  // init(T&) fills the instance, it runs on thread 0 only
+  template <typename Init>
+  SharedFixture(const ::benchmark::State& state, Init&& init) : owner_(state.thread_index() == 0) {
+    if (owner_) {
+      instance_ = new T();
+      std::forward<Init>(init)(*instance_);
+    }
+  }
+  explicit SharedFixture(const ::benchmark::State& state) : SharedFixture(state, [](T&) {}) {}
+
+  ~SharedFixture() {
+    if (owner_) {
+      delete instance_;
+      instance_ = nullptr;
+    }
+  }
+
+  SharedFixture(const SharedFixture&) = delete;
+  SharedFixture& operator=(const SharedFixture&) = delete;
+
+  T* operator->() const { return instance_; }
+};
+}  // namespace nyx::bench
+
+#endif  // !BENCHMARK_READ_SCALING_HPP
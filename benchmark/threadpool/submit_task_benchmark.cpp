@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "src/http/threadpool/include/base.hpp"
+#include "src/http/threadpool/include/centralized_threadpool.hpp"
+#include "src/http/threadpool/include/pooled_task.hpp"
+
+using namespace nyx::threadpool;
+using centralized::CentralizedThreadpool;
+
+// Every global allocation of the process is counted
+namespace {
+std::atomic<std::size_t> allocations{0};
+
+// Out of line, so the compiler never pairs the malloc of an inlined operator new with the free of an inlined
+// operator delete and reports them as mismatched
+[[gnu::noinline]] void* counted_allocate(std::size_t size) {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  if (auto* ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+[[gnu::noinline]] void counted_free(void* ptr) noexcept { std::free(ptr); }
+}  // namespace
+
+void* operator new(std::size_t size) { return counted_allocate(size); }
+void* operator new[](std::size_t size) { return counted_allocate(size); }
+void operator delete(void* ptr) noexcept { counted_free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { counted_free(ptr); }
+void operator delete[](void* ptr) noexcept { counted_free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { counted_free(ptr); }
+
+namespace {
+constexpr std::size_t kBatch = 64;
+
+int microtask(int value) { return value + 1; }
+
+// What submit_task did before the slab pool: bind, a shared packaged_task and a std::function around it
+struct PackagedTask {
+  static std::future<int> make(int value, Task& task) {
+    std::packaged_task<int()> packaged(std::bind(microtask, value));
+    auto task_ptr = std::make_shared<std::packaged_task<int()>>(std::move(packaged));
+    auto result = task_ptr->get_future();
+    task = [task_ptr]() { (*task_ptr)(); };
+    return result;
+  }
+};
+
+struct SlabPooledTask {
+  static std::future<int> make(int value, Task& task) {
+    auto* pooled = make_pooled_task<int>(microtask, value);
+    auto result = pooled->get_future();
+    task = pooled->task();
+    return result;
+  }
+};
+
+// Creating, running and collecting a task on one thread, without a queue in between
+template <typename Variant>
+void BM_TaskLifecycle(benchmark::State& state) {
+  std::vector<std::future<int>> futures(kBatch);
+  std::vector<Task> tasks(kBatch);
+  auto round = [&] {
+    for (std::size_t i = 0; i < kBatch; ++i) {
+      futures[i] = Variant::make(static_cast<int>(i), tasks[i]);
+    }
+    for (std::size_t i = 0; i < kBatch; ++i) {
+      tasks[i]();
+      tasks[i] = nullptr;
+      benchmark::DoNotOptimize(futures[i].get());
+    }
+  };
+  round();
+
+  auto before = allocations.load(std::memory_order_relaxed);
+  for (auto _ : state) {
+    round();
+  }
+  auto tasks_run = static_cast<double>(state.iterations() * kBatch);
+  state.counters["allocs_per_task"] = static_cast<double>(allocations.load(std::memory_order_relaxed) - before) / tasks_run;
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+
+// Microtasks submitted to a pool in batches, the worker frees what the submitting thread allocated
+void BM_SubmitMicrotask(benchmark::State& state) {
+  auto pool = CentralizedThreadpool::create(Config(static_cast<std::size_t>(state.range(0)), 2 * kBatch, "bench"));
+  std::vector<std::future<int>> futures(kBatch);
+  auto round = [&] {
+    for (std::size_t i = 0; i < kBatch; ++i) {
+      futures[i] = pool->submit_task(microtask, static_cast<int>(i));
+    }
+    for (auto& future : futures) {
+      benchmark::DoNotOptimize(future.get());
+    }
+  };
+  // Warms the caches of the submitting and the worker threads
+  for (int i = 0; i < 16; ++i) {
+    round();
+  }
+
+  auto before = allocations.load(std::memory_order_relaxed);
+  for (auto _ : state) {
+    round();
+  }
+  auto tasks_run = static_cast<double>(state.iterations() * kBatch);
+  state.counters["allocs_per_task"] = static_cast<double>(allocations.load(std::memory_order_relaxed) - before) / tasks_run;
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_TaskLifecycle, PackagedTask);
+BENCHMARK_TEMPLATE(BM_TaskLifecycle, SlabPooledTask);
+BENCHMARK(BM_SubmitMicrotask)->Arg(1)->Arg(4)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,340 @@
+#ifndef COROUTINE_CHANNEL_HPP
+#define COROUTINE_CHANNEL_HPP
+
+// Typed channels between coroutines, Go style.
+//
+// co_await channel.send(value) completes once the value is buffered or handed to a receiver, and
+// co_await channel.recv() once a value is available, yielding std::nullopt when the channel is closed and
+// drained. A coroutine that cannot complete is parked on the channel together with the Scheduler it runs on,
+// and the peer that later completes its operation posts it back there. A capacity of 0 makes every send a
+// rendezvous with a receiver.
+// co_await select(a, b, ...) receives from whichever channel is ready first. Every case points to one shared
+// claim: the first channel to claim it completes the select, the others drop their stale entry.
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "src/coroutine/include/scheduler.hpp"
+
+namespace nyx::coroutine {
+namespace channel_detail {
+constexpr std::size_t kNoWinner = SIZE_MAX;
+
+struct SelectState {
+  std::atomic<std::size_t> winner{kNoWinner};
+
+  bool claim(std::size_t index) noexcept {
+    auto expected = kNoWinner;
+    return winner.compare_exchange_strong(expected, index, std::memory_order_acq_rel, std::memory_order_acquire);
+  }
+};
+
+template <typename T>
+struct Receiver {
+  std::coroutine_handle<> handle;
+  Scheduler* scheduler;
+  std::optional<T>* slot;
+  // Set when the receiver is one case of a select
+  SelectState* select;
+  std::size_t index;
+};
+
+template <typename T>
+struct Sender {
+  std::coroutine_handle<> handle;
+  Scheduler* scheduler;
+  T* value;
+  bool* sent;
+};
+}  // namespace channel_detail
+
+template <typename T>
+struct SelectResult {
+  // Position of the channel that completed the select
+  std::size_t index;
+  // std::nullopt when that channel is closed
+  std::optional<T> value;
+};
+
+template <typename T, std::size_t N>
+class SelectAwaiter;
+
+template <typename T>
+class Channel {
+  using Receiver = channel_detail::Receiver<T>;
+  using Sender = channel_detail::Sender<T>;
+
+  std::size_t capacity_;
+  mutable std::mutex mutex_;
+  std::deque<T> buffer_;
+  // Parked coroutines, their entries live in their awaiters
+  std::deque<Receiver*> receivers_;
+  std::deque<Sender*> senders_;
+  bool closed_{false};
+
+  template <typename, std::size_t>
+  friend class SelectAwaiter;
+
+ public:
+  static constexpr std::size_t kUnbounded = SIZE_MAX;
+
+  explicit Channel(std::size_t capacity = kUnbounded) : capacity_(capacity) {}
+
+  Channel(const Channel&) = delete;
+  Channel& operator=(const Channel&) = delete;
+
+  class SendAwaiter {
+    Channel* channel_;
+    T value_;
+    bool sent_{false};
+    Sender sender_;
+
+   public:
+    SendAwaiter(Channel* channel, T value) : channel_(channel), value_(std::move(value)) {}
+
+    bool await_ready() const noexcept { return false; }
+    bool await_suspend(std::coroutine_handle<> handle);
+    // False when the channel was closed before the value could be sent.
+    bool await_resume() const noexcept { return sent_; }
+  };
+
+  class RecvAwaiter {
+    Channel* channel_;
+    std::optional<T> value_;
+    Receiver receiver_;
+
+   public:
+    explicit RecvAwaiter(Channel* channel) : channel_(channel) {}
+
+    bool await_ready() const noexcept { return false; }
+    bool await_suspend(std::coroutine_handle<> handle);
+    std::optional<T> await_resume() { return std::move(value_); }
+  };
+
+  // Must be awaited from a coroutine running on a Scheduler.
+  SendAwaiter send(T value) { return SendAwaiter(this, std::move(value)); }
+  RecvAwaiter recv() { return RecvAwaiter(this); }
+
+  // Non-blocking variants, usable from plain threads. try_send leaves value untouched when it fails.
+  bool try_send(T&& value);
+  bool try_send(const T& value) {
+    T copy(value);
+    return try_send(std::move(copy));
+  }
+  std::optional<T> try_recv();
+
+  // Wakes every parked receiver with std::nullopt and every parked sender with false. Buffered values can
+  // still be received.
+  void close();
+  bool closed() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return closed_;
+  }
+
+  std::size_t capacity() const noexcept { return capacity_; }
+  std::size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return buffer_.size();
+  }
+
+ private:
+  // All require mutex_
+  // Hands value to the first parked receiver still waiting, value is only moved from on success
+  bool deliver_(T& value);
+  // Next value: the oldest buffered one, else the one of the oldest parked sender
+  std::optional<T> take_();
+  bool ready_to_take_() const noexcept { return !buffer_.empty() || !senders_.empty() || closed_; }
+};
+
+// Awaitable returned by select().
+template <typename T, std::size_t N>
+class SelectAwaiter {
+  std::array<Channel<T>*, N> channels_;
+  channel_detail::SelectState state_;
+  std::optional<T> value_;
+  std::array<channel_detail::Receiver<T>, N> receivers_;
+  std::size_t registered_{0};
+
+ public:
+  explicit SelectAwaiter(std::array<Channel<T>*, N> channels) : channels_(channels) {}
+
+  SelectAwaiter(const SelectAwaiter&) = delete;
+  SelectAwaiter& operator=(const SelectAwaiter&) = delete;
+
+  bool await_ready() const noexcept { return false; }
+  bool await_suspend(std::coroutine_handle<> handle);
+  SelectResult<T> await_resume();
+};
+
+// Receives from the first of channels that has a value or is closed.
+template <typename T, typename... Rest>
+SelectAwaiter<T, 1 + sizeof...(Rest)> select(Channel<T>& first, Rest&... rest) {
+  return SelectAwaiter<T, 1 + sizeof...(Rest)>({&first, &rest...});
+}
+
+template <typename T>
+bool Channel<T>::SendAwaiter::await_suspend(std::coroutine_handle<> handle) {
+  std::lock_guard<std::mutex> lock(channel_->mutex_);
+  if (channel_->closed_) {
+    return false;
+  }
+  if (channel_->deliver_(value_)) {
+    sent_ = true;
+    return false;
+  }
+  if (channel_->buffer_.size() < channel_->capacity_) {
+    channel_->buffer_.push_back(std::move(value_));
+    sent_ = true;
+    return false;
+  }
+
+  assert(Scheduler::current() != nullptr);
+  sender_ = Sender{handle, Scheduler::current(), &value_, &sent_};
+  channel_->senders_.push_back(&sender_);
+  return true;
+}
+
+template <typename T>
+bool Channel<T>::RecvAwaiter::await_suspend(std::coroutine_handle<> handle) {
+  std::lock_guard<std::mutex> lock(channel_->mutex_);
+  if (channel_->ready_to_take_()) {
+    value_ = channel_->take_();
+    return false;
+  }
+
+  assert(Scheduler::current() != nullptr);
+  receiver_ = Receiver{handle, Scheduler::current(), &value_, nullptr, 0};
+  channel_->receivers_.push_back(&receiver_);
+  return true;
+}
+
+template <typename T>
+bool Channel<T>::try_send(T&& value) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (closed_) {
+    return false;
+  }
+  if (deliver_(value)) {
+    return true;
+  }
+  if (buffer_.size() < capacity_) {
+    buffer_.push_back(std::move(value));
+    return true;
+  }
+  return false;
+}
+
+template <typename T>
+std::optional<T> Channel<T>::try_recv() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return take_();
+}
+
+template <typename T>
+void Channel<T>::close() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  closed_ = true;
+
+  for (auto* receiver : receivers_) {
+    if (receiver->select == nullptr || receiver->select->claim(receiver->index)) {
+      receiver->scheduler->post(receiver->handle);
+    }
+  }
+  receivers_.clear();
+
+  for (auto* sender : senders_) {
+    sender->scheduler->post(sender->handle);
+  }
+  senders_.clear();
+}
+
+template <typename T>
+bool Channel<T>::deliver_(T& value) {
+  while (!receivers_.empty()) {
+    auto* receiver = receivers_.front();
+    receivers_.pop_front();
+    // Another case of its select won already
+    if (receiver->select != nullptr && !receiver->select->claim(receiver->index)) {
+      continue;
+    }
+
+    receiver->slot->emplace(std::move(value));
+    receiver->scheduler->post(receiver->handle);
+    return true;
+  }
+  return false;
+}
+
+template <typename T>
+std::optional<T> Channel<T>::take_() {
+  std::optional<T> value;
+  if (!buffer_.empty()) {
+    value.emplace(std::move(buffer_.front()));
+    buffer_.pop_front();
+    // Room for the oldest parked sender
+    if (!senders_.empty()) {
+      auto* sender = senders_.front();
+      senders_.pop_front();
+      buffer_.push_back(std::move(*sender->value));
+      *sender->sent = true;
+      sender->scheduler->post(sender->handle);
+    }
+  } else if (!senders_.empty()) {
+    auto* sender = senders_.front();
+    senders_.pop_front();
+    value.emplace(std::move(*sender->value));
+    *sender->sent = true;
+    sender->scheduler->post(sender->handle);
+  }
+  return value;
+}
+
+template <typename T, std::size_t N>
+bool SelectAwaiter<T, N>::await_suspend(std::coroutine_handle<> handle) {
+  assert(Scheduler::current() != nullptr);
+  for (std::size_t i = 0; i < N; ++i) {
+    auto* channel = channels_[i];
+    std::lock_guard<std::mutex> lock(channel->mutex_);
+    // A channel we registered on earlier claimed us and already posted the handle
+    if (state_.winner.load(std::memory_order_acquire) != channel_detail::kNoWinner) {
+      return true;
+    }
+
+    if (channel->ready_to_take_()) {
+      if (!state_.claim(i)) {
+        return true;
+      }
+      value_ = channel->take_();
+      return false;
+    }
+
+    receivers_[i] = channel_detail::Receiver<T>{handle, Scheduler::current(), &value_, &state_, i};
+    channel->receivers_.push_back(&receivers_[i]);
+    registered_ = i + 1;
+  }
+  return true;
+}
+
+template <typename T, std::size_t N>
+SelectResult<T> SelectAwaiter<T, N>::await_resume() {
+  // Entries of the losing cases must be gone before this frame moves on
+  for (std::size_t i = 0; i < registered_; ++i) {
+    auto* channel = channels_[i];
+    std::lock_guard<std::mutex> lock(channel->mutex_);
+    auto& receivers = channel->receivers_;
+    receivers.erase(std::remove(receivers.begin(), receivers.end(), &receivers_[i]), receivers.end());
+  }
+  return SelectResult<T>{state_.winner.load(std::memory_order_acquire), std::move(value_)};
+}
+}  // namespace nyx::coroutine
+
+#endif  // !COROUTINE_CHANNEL_HPP
@@ -0,0 +1,89 @@
+#ifndef COROUTINE_SCHEDULER_HPP
+#define COROUTINE_SCHEDULER_HPP
+
+// Single-threaded executor for C++20 coroutines.
+//
+// A Scheduler owns a queue of coroutines that are ready to run and resumes them on the thread that calls
+// poll() or run(). A coroutine waiting on a channel is parked on that channel, not on the scheduler, and is
+// posted back to the scheduler it was running on once the channel completes its operation, from whatever
+// thread did that. One thread can therefore multiplex any number of coroutines, and coroutines of different
+// schedulers can talk to each other through channels.
+//
+// Coroutines still parked when their scheduler is destroyed are leaked, close their channels first.
+
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace nyx::coroutine {
+// Fire-and-forget coroutine, starts once spawned on a Scheduler and frees itself when it returns.
+class Task {
+ public:
+  struct promise_type {
+    Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept { std::terminate(); }
+  };
+
+  Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+  Task& operator=(Task&&) = delete;
+  ~Task() {
+    if (handle_) {
+      handle_.destroy();
+    }
+  }
+
+  // Gives up ownership of the suspended coroutine.
+  std::coroutine_handle<> release() noexcept { return std::exchange(handle_, nullptr); }
+
+ private:
+  explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+  std::coroutine_handle<promise_type> handle_;
+};
+
+class Scheduler {
+  std::mutex mutex_;
+  std::condition_variable ready_cv_;
+  std::vector<std::coroutine_handle<>> ready_;
+  bool stop_{false};
+
+ public:
+  Scheduler() = default;
+  Scheduler(const Scheduler&) = delete;
+  Scheduler& operator=(const Scheduler&) = delete;
+
+  // Scheduler resuming the calling coroutine, nullptr outside of poll() and run().
+  static Scheduler* current() noexcept;
+
+  // Any thread.
+  void spawn(Task task) { post(task.release()); }
+  void post(std::coroutine_handle<> handle);
+  // Makes run() return once nothing is ready anymore.
+  void stop();
+
+  // Resumes coroutines until none is ready, returns how many were resumed.
+  std::size_t poll();
+  // Like poll() but sleeps while idle, until stop() is called.
+  void run();
+
+  // Awaitable that moves the calling coroutine to the back of the ready queue.
+  auto yield() noexcept {
+    struct Awaiter {
+      Scheduler* scheduler;
+      bool await_ready() const noexcept { return false; }
+      void await_suspend(std::coroutine_handle<> handle) { scheduler->post(handle); }
+      void await_resume() const noexcept {}
+    };
+    return Awaiter{this};
+  }
+};
+}  // namespace nyx::coroutine
+
+#endif  // !COROUTINE_SCHEDULER_HPP
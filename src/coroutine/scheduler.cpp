@@ -0,0 +1,69 @@
+#include "include/scheduler.hpp"
+
+namespace nyx::coroutine {
+namespace {
+thread_local Scheduler* current_scheduler = nullptr;
+
+// Restores the outer scheduler, poll() may be nested inside a coroutine of another scheduler
+class CurrentScope {
+  Scheduler* previous_;
+
+ public:
+  explicit CurrentScope(Scheduler* scheduler) : previous_(std::exchange(current_scheduler, scheduler)) {}
+  ~CurrentScope() { current_scheduler = previous_; }
+};
+}  // namespace
+
+Scheduler* Scheduler::current() noexcept { return current_scheduler; }
+
+void Scheduler::post(std::coroutine_handle<> handle) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ready_.push_back(handle);
+  }
+  ready_cv_.notify_one();
+}
+
+void Scheduler::stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  ready_cv_.notify_one();
+}
+
+std::size_t Scheduler::poll() {
+  CurrentScope scope(this);
+  std::size_t resumed = 0;
+  std::vector<std::coroutine_handle<>> batch;
+  while (true) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (ready_.empty()) {
+        return resumed;
+      }
+      batch.swap(ready_);
+    }
+
+    // Resumed coroutines post to ready_, never to batch
+    for (auto handle : batch) {
+      handle.resume();
+    }
+    resumed += batch.size();
+    batch.clear();
+  }
+}
+
+void Scheduler::run() {
+  while (true) {
+    poll();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    ready_cv_.wait(lock, [this] { return stop_ || !ready_.empty(); });
+    if (stop_ && ready_.empty()) {
+      stop_ = false;
+      return;
+    }
+  }
+}
+}  // namespace nyx::coroutine
@@ -0,0 +1,204 @@
+#ifndef DATA_STRUCTURE_BLOCKING_SCSP_QUEUE_HPP
+#define DATA_STRUCTURE_BLOCKING_SCSP_QUEUE_HPP
+
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <utility>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "src/common/include/define.hpp"
+#include "src/data_structure/scsp_lockfree_queue.hpp"
+
+namespace nyx::data_structure {
+
+using namespace common::define;
+
+// A wait strategy blocks one side of the queue until a cursor word moves away from an observed value.
+//   void wait(const std::atomic<std::size_t>& word, std::size_t old) - returns once word != old (may return spuriously)
+//   void notify(std::atomic<std::size_t>& word)                      - called after the owner of word advanced it
+namespace wait_strategy {
+inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  asm volatile("yield");
+#endif
+}
+
+// Lowest latency, keeps the waiting core at 100%.
+struct BusySpin {
+  void wait(const std::atomic<std::size_t>& word, std::size_t old) {
+    while (word.load(std::memory_order_acquire) == old) {
+      cpu_relax();
+    }
+  }
+
+  void notify(std::atomic<std::size_t>&) {}
+};
+
+// Spins for a short while, then gives the core away between checks.
+template <std::size_t SpinCount = 128>
+struct SpinThenYield {
+  void wait(const std::atomic<std::size_t>& word, std::size_t old) {
+    for (std::size_t i = 0; i < SpinCount; ++i) {
+      if (word.load(std::memory_order_acquire) != old) {
+        return;
+      }
+      cpu_relax();
+    }
+
+    while (word.load(std::memory_order_acquire) == old) {
+      std::this_thread::yield();
+    }
+  }
+
+  void notify(std::atomic<std::size_t>&) {}
+};
+
+// Spins briefly, then parks the thread in the kernel on the cursor word itself.
+// The notifier only pays for a wake syscall when a waiter announced itself in parked_, and then wakes every
+// thread parked on the word, since several consumers of a MulticastRing may wait on the same cursor.
+template <std::size_t SpinCount = 128>
+struct Futex {
+  alignas(hardware_constructive_interference_size) std::atomic<std::uint32_t> parked_{0};
+
+  void wait(const std::atomic<std::size_t>& word, std::size_t old) {
+    for (std::size_t i = 0; i < SpinCount; ++i) {
+      if (word.load(std::memory_order_acquire) != old) {
+        return;
+      }
+      cpu_relax();
+    }
+
+    // Pairs with the fence in notify(): either the notifier sees parked_ or we see the new cursor.
+    parked_.fetch_add(1, std::memory_order_seq_cst);
+    while (word.load(std::memory_order_seq_cst) == old) {
+      park_(word, old);
+    }
+    parked_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  void notify(std::atomic<std::size_t>& word) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (parked_.load(std::memory_order_relaxed) != 0) {
+      unpark_(word);
+    }
+  }
+
+ private:
+#if defined(__linux__)
+  static_assert(sizeof(std::atomic<std::size_t>) == sizeof(std::size_t));
+
+  // The futex word is the low 32 bits of the cursor, which always change when the cursor advances by less than 2^32.
+  static std::uint32_t* futex_word_(const std::atomic<std::size_t>& word) {
+    auto base = reinterpret_cast<std::uint32_t*>(const_cast<std::atomic<std::size_t>*>(&word));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return base + 1;
+#else
+    return base;
+#endif
+  }
+
+  static void park_(const std::atomic<std::size_t>& word, std::size_t old) {
+    syscall(SYS_futex, futex_word_(word), FUTEX_WAIT_PRIVATE, static_cast<std::uint32_t>(old), nullptr, nullptr, 0);
+  }
+
+  static void unpark_(std::atomic<std::size_t>& word) { syscall(SYS_futex, futex_word_(word), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0); }
+#else
+  static void park_(const std::atomic<std::size_t>& word, std::size_t old) { word.wait(old, std::memory_order_acquire); }
+  static void unpark_(std::atomic<std::size_t>& word) { word.notify_all(); }
+#endif
+};
+}  // namespace wait_strategy
+
+// Blocking front-end for ScspLockFreeQueue. The consumer waits on the push cursor when the queue is empty,
+// the producer waits on the pop cursor when it is full.
+template <typename T, typename WaitStrategy = wait_strategy::Futex<>, typename Alloc = std::allocator<T>>
+class BlockingScspQueue {
+  ScspLockFreeQueue<T, Alloc> queue_;
+  WaitStrategy not_empty_;
+  WaitStrategy not_full_;
+
+ public:
+  explicit BlockingScspQueue(std::size_t capacity, Alloc const& alloc = Alloc{}) : queue_(capacity, alloc) {}
+
+  std::size_t capacity() const { return queue_.capacity(); }
+  bool empty() { return queue_.empty(); }
+
+  bool try_push(T const&);
+  bool try_push(T&&);
+  bool try_pop(T&);
+
+  void push(T const&);
+  void push(T&&);
+  void pop(T&);
+};
+
+template <typename T, typename WaitStrategy, typename Alloc>
+bool BlockingScspQueue<T, WaitStrategy, Alloc>::try_push(T const& value) {
+  if (!queue_.push(value)) {
+    return false;
+  }
+
+  not_empty_.notify(queue_.push_cursor_);
+  return true;
+}
+
+template <typename T, typename WaitStrategy, typename Alloc>
+bool BlockingScspQueue<T, WaitStrategy, Alloc>::try_push(T&& value) {
+  if (!queue_.push(std::move(value))) {
+    return false;
+  }
+
+  not_empty_.notify(queue_.push_cursor_);
+  return true;
+}
+
+template <typename T, typename WaitStrategy, typename Alloc>
+bool BlockingScspQueue<T, WaitStrategy, Alloc>::try_pop(T& value) {
+  if (!queue_.pop(value)) {
+    return false;
+  }
+
+  not_full_.notify(queue_.pop_cursor_);
+  return true;
+}
+
+template <typename T, typename WaitStrategy, typename Alloc>
+void BlockingScspQueue<T, WaitStrategy, Alloc>::push(T const& value) {
+  while (!try_push(value)) {
+    // Full means the consumer is exactly one lap behind us
+    auto push_cursor = queue_.push_cursor_.load(std::memory_order_relaxed);
+    not_full_.wait(queue_.pop_cursor_, push_cursor - queue_.capacity());
+  }
+}
+
+template <typename T, typename WaitStrategy, typename Alloc>
+void BlockingScspQueue<T, WaitStrategy, Alloc>::push(T&& value) {
+  // push(T&&) only moves from value when it succeeds
+  while (!try_push(std::move(value))) {
+    auto push_cursor = queue_.push_cursor_.load(std::memory_order_relaxed);
+    not_full_.wait(queue_.pop_cursor_, push_cursor - queue_.capacity());
+  }
+}
+
+template <typename T, typename WaitStrategy, typename Alloc>
+void BlockingScspQueue<T, WaitStrategy, Alloc>::pop(T& value) {
+  while (!try_pop(value)) {
+    // Empty means the producer has not moved past our own cursor
+    auto pop_cursor = queue_.pop_cursor_.load(std::memory_order_relaxed);
+    not_empty_.wait(queue_.push_cursor_, pop_cursor);
+  }
+}
+}  // namespace nyx::data_structure
+
+#endif  // !DATA_STRUCTURE_BLOCKING_SCSP_QUEUE_HPP
@@ -0,0 +1,351 @@
+#ifndef DATA_STRUCTURE_CONCURRENT_HASH_MAP_HPP
+#define DATA_STRUCTURE_CONCURRENT_HASH_MAP_HPP
+
+// Hash map shared between threads. Readers never lock, writers lock one stripe.
+//
+// Buckets are chains of immutable nodes: an assignment publishes a new node in place of the old one and an
+// erase unlinks the node, either way the old node is retired through epoch-based reclamation, so a reader
+// that pinned the epoch can walk a chain while writers change it.
+// Writers of keys that fall into the same stripe serialize on its mutex. A stripe covers the same buckets
+// in every table size, which is what makes resizing incremental: once a stripe outgrows its share of
+// buckets, a table twice as large is attached to the current one, and every write then migrates a few
+// buckets into it under their stripe locks. A migrated bucket is left with a forwarding marker that sends
+// readers and writers to the next table, and the old table is retired when its last bucket moved.
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "src/common/include/define.hpp"
+#include "src/memory/include/epoch.hpp"
+
+namespace nyx::data_structure {
+
+using namespace common::define;
+
+// K and V are copied when a bucket migrates to a larger table.
+template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class ConcurrentHashMap : private Hash, private KeyEqual {
+  static constexpr std::size_t kMinBucketsPerStripe = 8;
+  // Buckets migrated by every write while a resize is in progress
+  static constexpr std::size_t kMigrateStep = 16;
+
+  struct Node {
+    std::size_t hash;
+    K key;
+    V value;
+    std::atomic<Node*> next;
+  };
+
+  struct Table {
+    std::size_t mask;
+    std::unique_ptr<std::atomic<Node*>[]> buckets;
+    std::atomic<Table*> next{nullptr};  // table being migrated into
+    std::atomic<std::size_t> claimed{0};
+    std::atomic<std::size_t> migrated{0};
+
+    explicit Table(std::size_t size) : mask(size - 1), buckets(std::make_unique<std::atomic<Node*>[]>(size)) {}
+  };
+
+  struct alignas(hardware_constructive_interference_size) Stripe {
+    std::mutex mutex;
+    std::atomic<std::size_t> size{0};  // written under mutex
+  };
+
+  alignas(hardware_constructive_interference_size) std::atomic<Table*> table_;
+  std::size_t stripe_mask_;
+  std::unique_ptr<Stripe[]> stripes_;
+
+  char padding_[kPaddingSize];
+
+ public:
+  // stripes is rounded up to a power of two, it bounds the number of concurrent writers.
+  explicit ConcurrentHashMap(std::size_t capacity = 0, std::size_t stripes = 64);
+  ~ConcurrentHashMap();
+
+  ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+  ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+
+  // Copy of the value, never blocks.
+  std::optional<V> find(const K&) const;
+  bool contains(const K& key) const { return find(key).has_value(); }
+
+  // Returns true when key was inserted, false when an existing value was replaced.
+  bool insert_or_assign(const K&, V);
+  bool erase(const K&);
+  // Calls fn(std::optional<V>&) with the current value under the stripe lock. The key is stored with the
+  // value fn leaves in the optional, or erased when fn resets it. Returns that value.
+  template <typename F>
+  std::optional<V> compute(const K&, F&& fn);
+
+  // Approximate when other threads are writing.
+  std::size_t size() const noexcept;
+  bool empty() const noexcept { return size() == 0; }
+  std::size_t bucket_count() const noexcept;
+  std::size_t stripe_count() const noexcept { return stripe_mask_ + 1; }
+
+ private:
+  static Node* moved_() noexcept { return reinterpret_cast<Node*>(std::uintptr_t{1}); }
+
+  // std::hash is the identity for integers, buckets and stripes take the low bits
+  std::size_t hash_(const K& key) const {
+    std::uint64_t h = Hash::operator()(key);
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    return static_cast<std::size_t>(h);
+  }
+
+  // Locks the stripe of key, finds the bucket that holds it and calls op(bucket, link, stripe, hash) where link
+  // points at the node of key, or at the null end of the chain. Helps a resize afterwards.
+  template <typename Op>
+  auto update_(const K& key, std::size_t hash, Op&& op);
+
+  void insert_(std::atomic<Node*>& bucket, Stripe&, std::size_t hash, const K&, V&&);
+  void replace_(std::atomic<Node*>& link, V&&);
+  void erase_(std::atomic<Node*>& link, Stripe&);
+
+  void start_resize_(Table*);
+  void help_resize_();
+  void migrate_bucket_(Table* from, Table* to, std::size_t index);
+};
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+ConcurrentHashMap<K, V, Hash, KeyEqual>::ConcurrentHashMap(std::size_t capacity, std::size_t stripes)
+    : stripe_mask_(std::bit_ceil(std::max<std::size_t>(stripes, 1)) - 1), stripes_(std::make_unique<Stripe[]>(stripe_mask_ + 1)) {
+  auto buckets = std::bit_ceil(std::max(capacity, (stripe_mask_ + 1) * kMinBucketsPerStripe));
+  table_.store(new Table(buckets), std::memory_order_release);
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+ConcurrentHashMap<K, V, Hash, KeyEqual>::~ConcurrentHashMap() {
+  // A resize may be in progress, then live nodes are spread over two tables
+  for (auto* table = table_.load(std::memory_order_acquire); table != nullptr;) {
+    for (std::size_t i = 0; i <= table->mask; ++i) {
+      auto* node = table->buckets[i].load(std::memory_order_relaxed);
+      if (node == moved_()) {
+        continue;
+      }
+      while (node != nullptr) {
+        delete std::exchange(node, node->next.load(std::memory_order_relaxed));
+      }
+    }
+    delete std::exchange(table, table->next.load(std::memory_order_relaxed));
+  }
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+std::optional<V> ConcurrentHashMap<K, V, Hash, KeyEqual>::find(const K& key) const {
+  auto hash = hash_(key);
+  memory::epoch::Guard guard;
+
+  auto* table = table_.load(std::memory_order_acquire);
+  auto* node = table->buckets[hash & table->mask].load(std::memory_order_acquire);
+  while (node == moved_()) {
+    table = table->next.load(std::memory_order_acquire);
+    node = table->buckets[hash & table->mask].load(std::memory_order_acquire);
+  }
+
+  for (; node != nullptr; node = node->next.load(std::memory_order_acquire)) {
+    if (node->hash == hash && KeyEqual::operator()(node->key, key)) {
+      return node->value;
+    }
+  }
+  return std::nullopt;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+bool ConcurrentHashMap<K, V, Hash, KeyEqual>::insert_or_assign(const K& key, V value) {
+  return update_(key, hash_(key), [&](std::atomic<Node*>& bucket, std::atomic<Node*>& link, Stripe& stripe, std::size_t hash) {
+    if (link.load(std::memory_order_relaxed) == nullptr) {
+      insert_(bucket, stripe, hash, key, std::move(value));
+      return true;
+    }
+    replace_(link, std::move(value));
+    return false;
+  });
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+bool ConcurrentHashMap<K, V, Hash, KeyEqual>::erase(const K& key) {
+  return update_(key, hash_(key), [&](std::atomic<Node*>&, std::atomic<Node*>& link, Stripe& stripe, std::size_t) {
+    if (link.load(std::memory_order_relaxed) == nullptr) {
+      return false;
+    }
+    erase_(link, stripe);
+    return true;
+  });
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+template <typename F>
+std::optional<V> ConcurrentHashMap<K, V, Hash, KeyEqual>::compute(const K& key, F&& fn) {
+  return update_(key, hash_(key), [&](std::atomic<Node*>& bucket, std::atomic<Node*>& link, Stripe& stripe, std::size_t hash) {
+    auto* node = link.load(std::memory_order_relaxed);
+    std::optional<V> value;
+    if (node != nullptr) {
+      value.emplace(node->value);
+    }
+
+    std::forward<F>(fn)(value);
+
+    if (value.has_value()) {
+      // Nodes are immutable, the result is published as a new node either way
+      V copy = *value;
+      if (node == nullptr) {
+        insert_(bucket, stripe, hash, key, std::move(copy));
+      } else {
+        replace_(link, std::move(copy));
+      }
+    } else if (node != nullptr) {
+      erase_(link, stripe);
+    }
+    return value;
+  });
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+std::size_t ConcurrentHashMap<K, V, Hash, KeyEqual>::size() const noexcept {
+  std::size_t size = 0;
+  for (std::size_t i = 0; i <= stripe_mask_; ++i) {
+    size += stripes_[i].size.load(std::memory_order_relaxed);
+  }
+  return size;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+std::size_t ConcurrentHashMap<K, V, Hash, KeyEqual>::bucket_count() const noexcept {
+  memory::epoch::Guard guard;
+  return table_.load(std::memory_order_acquire)->mask + 1;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+template <typename Op>
+auto ConcurrentHashMap<K, V, Hash, KeyEqual>::update_(const K& key, std::size_t hash, Op&& op) {
+  memory::epoch::Guard guard;
+  auto& stripe = stripes_[hash & stripe_mask_];
+
+  auto result = [&] {
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+
+    // Buckets of this stripe only move while its lock is held, so the bucket found here stays put
+    auto* table = table_.load(std::memory_order_acquire);
+    auto* bucket = &table->buckets[hash & table->mask];
+    while (bucket->load(std::memory_order_relaxed) == moved_()) {
+      table = table->next.load(std::memory_order_acquire);
+      bucket = &table->buckets[hash & table->mask];
+    }
+
+    auto* link = bucket;
+    for (auto* node = link->load(std::memory_order_relaxed); node != nullptr; node = link->load(std::memory_order_relaxed)) {
+      if (node->hash == hash && KeyEqual::operator()(node->key, key)) {
+        break;
+      }
+      link = &node->next;
+    }
+
+    auto value = op(*bucket, *link, stripe, hash);
+
+    // Every stripe owns the same share of buckets, so a stripe above load factor 1 stands for the table.
+    // Only the current table grows, a table that is still being migrated into waits for its promotion.
+    auto buckets_per_stripe = (table->mask + 1) / (stripe_mask_ + 1);
+    if (stripe.size.load(std::memory_order_relaxed) > buckets_per_stripe && table == table_.load(std::memory_order_relaxed) &&
+        table->next.load(std::memory_order_relaxed) == nullptr) {
+      start_resize_(table);
+    }
+    return value;
+  }();
+
+  help_resize_();
+  return result;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void ConcurrentHashMap<K, V, Hash, KeyEqual>::insert_(std::atomic<Node*>& bucket, Stripe& stripe, std::size_t hash, const K& key, V&& value) {
+  auto* node = new Node{hash, key, std::move(value), bucket.load(std::memory_order_relaxed)};
+  bucket.store(node, std::memory_order_release);
+  stripe.size.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void ConcurrentHashMap<K, V, Hash, KeyEqual>::replace_(std::atomic<Node*>& link, V&& value) {
+  auto* old = link.load(std::memory_order_relaxed);
+  auto* node = new Node{old->hash, old->key, std::move(value), old->next.load(std::memory_order_relaxed)};
+  link.store(node, std::memory_order_release);
+  memory::epoch::retire(old);
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void ConcurrentHashMap<K, V, Hash, KeyEqual>::erase_(std::atomic<Node*>& link, Stripe& stripe) {
+  auto* old = link.load(std::memory_order_relaxed);
+  link.store(old->next.load(std::memory_order_relaxed), std::memory_order_release);
+  memory::epoch::retire(old);
+  stripe.size.fetch_sub(1, std::memory_order_relaxed);
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void ConcurrentHashMap<K, V, Hash, KeyEqual>::start_resize_(Table* table) {
+  auto* next = new Table((table->mask + 1) * 2);
+  Table* expected = nullptr;
+  if (!table->next.compare_exchange_strong(expected, next, std::memory_order_acq_rel)) {
+    delete next;
+  }
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void ConcurrentHashMap<K, V, Hash, KeyEqual>::help_resize_() {
+  auto* table = table_.load(std::memory_order_acquire);
+  auto* next = table->next.load(std::memory_order_acquire);
+  if (next == nullptr) {
+    return;
+  }
+
+  auto size = table->mask + 1;
+  auto begin = table->claimed.fetch_add(kMigrateStep, std::memory_order_relaxed);
+  if (begin >= size) {
+    return;
+  }
+
+  auto end = std::min(begin + kMigrateStep, size);
+  for (auto i = begin; i < end; ++i) {
+    std::lock_guard<std::mutex> lock(stripes_[i & stripe_mask_].mutex);
+    migrate_bucket_(table, next, i);
+  }
+
+  // Whoever moves the last bucket promotes the next table
+  if (table->migrated.fetch_add(end - begin, std::memory_order_acq_rel) + (end - begin) == size) {
+    table_.store(next, std::memory_order_release);
+    memory::epoch::retire(table);
+  }
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void ConcurrentHashMap<K, V, Hash, KeyEqual>::migrate_bucket_(Table* from, Table* to, std::size_t index) {
+  auto& bucket = from->buckets[index];
+  auto* head = bucket.load(std::memory_order_relaxed);
+
+  // Readers may still be walking the old chain, so it is copied rather than relinked
+  Node* low = nullptr;
+  Node* high = nullptr;
+  for (auto* node = head; node != nullptr; node = node->next.load(std::memory_order_relaxed)) {
+    auto& chain = (node->hash & (from->mask + 1)) ? high : low;
+    chain = new Node{node->hash, node->key, node->value, chain};
+  }
+  to->buckets[index].store(low, std::memory_order_release);
+  to->buckets[index + from->mask + 1].store(high, std::memory_order_release);
+  bucket.store(moved_(), std::memory_order_release);
+
+  while (head != nullptr) {
+    memory::epoch::retire(std::exchange(head, head->next.load(std::memory_order_relaxed)));
+  }
+}
+}  // namespace nyx::data_structure
+
+#endif  // !DATA_STRUCTURE_CONCURRENT_HASH_MAP_HPP
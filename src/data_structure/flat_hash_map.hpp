@@ -0,0 +1,597 @@
+#ifndef DATA_STRUCTURE_FLAT_HASH_MAP_HPP
+#define DATA_STRUCTURE_FLAT_HASH_MAP_HPP
+
+// Open-addressing hash map in the style of Swiss tables (abseil's flat_hash_map).
+//
+// Every slot has a control byte: empty, deleted, or the 7 low bits (H2) of the hash of the key stored there.
+// A lookup hashes once, starts at H1 = hash >> 7 and compares a whole group of control bytes against H2 at
+// once (32 bytes with AVX2, 16 with SSE2, 8 with portable SWAR code), so keys are only compared for the few
+// slots whose H2 matches. Probing stops at the first group that has an empty byte.
+// Values are stored inline: no allocation per element, but references are invalidated by a rehash.
+//
+// The interface follows std::unordered_map for the operations the containers in this repo use, lookups
+// accept any type when Hash and KeyEqual are transparent.
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace nyx::data_structure {
+namespace flat_hash_map_detail {
+using ctrl_t = std::int8_t;
+
+constexpr ctrl_t kEmpty = -128;  // 0b10000000
+constexpr ctrl_t kDeleted = -2;  // 0b11111110
+
+// Positions that matched in a group, Shift converts a bit index into a byte index
+template <typename Word, int Shift>
+class BitMask {
+  Word mask_;
+
+ public:
+  explicit BitMask(Word mask) : mask_(mask) {}
+
+  explicit operator bool() const noexcept { return mask_ != 0; }
+  std::size_t lowest() const noexcept { return static_cast<std::size_t>(std::countr_zero(mask_)) >> Shift; }
+  void pop_lowest() noexcept { mask_ &= mask_ - 1; }
+};
+
+#if defined(__AVX2__)
+struct Group {
+  static constexpr std::size_t kWidth = 32;
+  using Mask = BitMask<std::uint32_t, 0>;
+
+  __m256i ctrl;
+
+  explicit Group(const ctrl_t* pos) : ctrl(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pos))) {}
+
+  Mask match(ctrl_t h2) const noexcept { return Mask(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_set1_epi8(h2), ctrl)))); }
+  Mask match_empty() const noexcept { return match(kEmpty); }
+  // Empty and deleted are the only control bytes with the sign bit set
+  Mask match_empty_or_deleted() const noexcept { return Mask(static_cast<std::uint32_t>(_mm256_movemask_epi8(ctrl))); }
+};
+#elif defined(__SSE2__)
+struct Group {
+  static constexpr std::size_t kWidth = 16;
+  using Mask = BitMask<std::uint32_t, 0>;
+
+  __m128i ctrl;
+
+  explicit Group(const ctrl_t* pos) : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos))) {}
+
+  Mask match(ctrl_t h2) const noexcept { return Mask(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl)))); }
+  Mask match_empty() const noexcept { return match(kEmpty); }
+  // Empty and deleted are the only control bytes with the sign bit set
+  Mask match_empty_or_deleted() const noexcept { return Mask(static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl))); }
+};
+#else
+struct Group {
+  static constexpr std::size_t kWidth = 8;
+  using Mask = BitMask<std::uint64_t, 3>;
+
+  static constexpr std::uint64_t kLsbs = 0x0101010101010101ULL;
+  static constexpr std::uint64_t kMsbs = 0x8080808080808080ULL;
+
+  std::uint64_t ctrl;
+
+  explicit Group(const ctrl_t* pos) {
+    std::memcpy(&ctrl, pos, sizeof(ctrl));
+    if constexpr (std::endian::native == std::endian::big) {
+      ctrl = __builtin_bswap64(ctrl);
+    }
+  }
+
+  // May report a false positive next to a real match, callers compare the keys anyway
+  Mask match(ctrl_t h2) const noexcept {
+    auto x = ctrl ^ (kLsbs * static_cast<std::uint8_t>(h2));
+    return Mask((x - kLsbs) & ~x & kMsbs);
+  }
+  // Bit 1 tells empty from deleted
+  Mask match_empty() const noexcept { return Mask(ctrl & ~(ctrl << 6) & kMsbs); }
+  Mask match_empty_or_deleted() const noexcept { return Mask(ctrl & kMsbs); }
+};
+#endif
+
+// Alias members instead of std::conditional_t, so that the argument of a transparent lookup stays deducible
+template <bool Transparent>
+struct KeyArg {
+  template <typename Key, typename K>
+  using type = Key;
+};
+
+template <>
+struct KeyArg<false> {
+  template <typename Key, typename K>
+  using type = K;
+};
+}  // namespace flat_hash_map_detail
+
+template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>,
+          typename Alloc = std::allocator<std::pair<const K, V>>>
+class FlatHashMap : private Hash, private KeyEqual, private Alloc {
+  using ctrl_t = flat_hash_map_detail::ctrl_t;
+  using Group = flat_hash_map_detail::Group;
+  static constexpr ctrl_t kEmpty = flat_hash_map_detail::kEmpty;
+  static constexpr ctrl_t kDeleted = flat_hash_map_detail::kDeleted;
+
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using value_type = std::pair<const K, V>;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Alloc;
+
+ private:
+  using AllocTraits = std::allocator_traits<Alloc>;
+  using CtrlAlloc = typename AllocTraits::template rebind_alloc<ctrl_t>;
+  using CtrlAllocTraits = std::allocator_traits<CtrlAlloc>;
+
+  static constexpr bool kTransparent = requires {
+    typename Hash::is_transparent;
+    typename KeyEqual::is_transparent;
+  };
+  // Lookups take any Key when the functors are transparent, otherwise Key is not deduced and stays K
+  template <typename Key>
+  using key_arg = typename flat_hash_map_detail::KeyArg<kTransparent>::template type<Key, K>;
+
+  ctrl_t* ctrl_{nullptr};
+  value_type* slots_{nullptr};
+  std::size_t capacity_{0};  // 0 or a power of two not below Group::kWidth
+  std::size_t size_{0};
+  std::size_t growth_left_{0};  // inserts into empty slots left before the load factor is reached
+
+ public:
+  template <bool Const>
+  class Iterator {
+    friend class FlatHashMap;
+
+    using Map = std::conditional_t<Const, const FlatHashMap, FlatHashMap>;
+    Map* map_;
+    std::size_t index_;
+
+    Iterator(Map* map, std::size_t index) : map_(map), index_(index) { skip_free_(); }
+
+    void skip_free_() {
+      while (index_ < map_->capacity_ && map_->ctrl_[index_] < 0) {
+        ++index_;
+      }
+    }
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = FlatHashMap::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+    using reference = std::conditional_t<Const, const value_type&, value_type&>;
+
+    Iterator() : map_(nullptr), index_(0) {}
+    // iterator converts to const_iterator
+    operator Iterator<true>() const { return Iterator<true>(map_, index_); }
+
+    reference operator*() const { return map_->slots_[index_]; }
+    pointer operator->() const { return &map_->slots_[index_]; }
+
+    Iterator& operator++() {
+      ++index_;
+      skip_free_();
+      return *this;
+    }
+    Iterator operator++(int) {
+      auto copy = *this;
+      ++*this;
+      return copy;
+    }
+
+    bool operator==(const Iterator& other) const { return map_ == other.map_ && index_ == other.index_; }
+  };
+
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+ public:
+  FlatHashMap() = default;
+  explicit FlatHashMap(std::size_t bucket_count, Hash const& hash = Hash{}, KeyEqual const& equal = KeyEqual{}, Alloc const& alloc = Alloc{});
+  FlatHashMap(const FlatHashMap&);
+  FlatHashMap(FlatHashMap&&) noexcept;
+  FlatHashMap& operator=(FlatHashMap);
+  ~FlatHashMap();
+
+  iterator begin() noexcept { return {this, 0}; }
+  iterator end() noexcept { return {this, capacity_}; }
+  const_iterator begin() const noexcept { return {this, 0}; }
+  const_iterator end() const noexcept { return {this, capacity_}; }
+
+  bool empty() const noexcept { return size_ == 0; }
+  std::size_t size() const noexcept { return size_; }
+  std::size_t capacity() const noexcept { return capacity_; }
+  static constexpr std::size_t group_width() noexcept { return Group::kWidth; }
+
+  void clear() noexcept;
+  // Makes room for count elements without rehashing.
+  void reserve(std::size_t count);
+
+  template <typename Key = K>
+  iterator find(const key_arg<Key>& key) {
+    return {this, find_index_(key)};
+  }
+  template <typename Key = K>
+  const_iterator find(const key_arg<Key>& key) const {
+    return {this, find_index_(key)};
+  }
+  template <typename Key = K>
+  bool contains(const key_arg<Key>& key) const {
+    return find_index_(key) != capacity_;
+  }
+  template <typename Key = K>
+  std::size_t count(const key_arg<Key>& key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  V& at(const K&);
+  const V& at(const K&) const;
+  V& operator[](const K& key) { return try_emplace(key).first->second; }
+  V& operator[](K&& key) { return try_emplace(std::move(key)).first->second; }
+
+  template <typename Key, typename... Args>
+  std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args);
+  template <typename Key, typename M>
+  std::pair<iterator, bool> insert_or_assign(Key&& key, M&& value);
+  std::pair<iterator, bool> insert(const value_type& value) { return try_emplace(value.first, value.second); }
+  std::pair<iterator, bool> insert(value_type&& value) { return try_emplace(std::move(const_cast<K&>(value.first)), std::move(value.second)); }
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+
+  template <typename Key = K>
+  std::size_t erase(const key_arg<Key>& key) {
+    auto index = find_index_(key);
+    if (index == capacity_) {
+      return 0;
+    }
+    erase_index_(index);
+    return 1;
+  }
+  iterator erase(const_iterator it);
+  iterator erase(iterator it) { return erase(const_iterator(it)); }
+
+ private:
+  // Spreads the hash, std::hash is the identity for integers
+  template <typename Key>
+  std::size_t hash_(const Key& key) const {
+    std::uint64_t h = Hash::operator()(key);
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    return static_cast<std::size_t>(h);
+  }
+  static ctrl_t h2_(std::size_t hash) noexcept { return static_cast<ctrl_t>(hash & 0x7F); }
+  static std::size_t h1_(std::size_t hash) noexcept { return hash >> 7; }
+  static std::size_t max_load_(std::size_t capacity) noexcept { return capacity - capacity / 8; }
+
+  template <typename Key>
+  std::size_t find_index_(const Key&) const;
+  // First empty or deleted slot on the probe sequence of hash
+  std::size_t find_free_(std::size_t hash) const noexcept;
+  // Index of key, inserting a slot with ctrl set (but no element constructed) when absent
+  template <typename Key>
+  std::pair<std::size_t, bool> find_or_prepare_insert_(const Key&);
+  void set_ctrl_(std::size_t index, ctrl_t value) noexcept;
+  void erase_index_(std::size_t) noexcept;
+
+  void resize_(std::size_t capacity);
+  void allocate_(std::size_t capacity);
+  void deallocate_() noexcept;
+  void destroy_elements_() noexcept;
+};
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+FlatHashMap<K, V, Hash, KeyEqual, Alloc>::FlatHashMap(std::size_t bucket_count, Hash const& hash, KeyEqual const& equal, Alloc const& alloc)
+    : Hash{hash}, KeyEqual{equal}, Alloc{alloc} {
+  reserve(bucket_count);
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+FlatHashMap<K, V, Hash, KeyEqual, Alloc>::FlatHashMap(const FlatHashMap& other)
+    : Hash{other}, KeyEqual{other}, Alloc{AllocTraits::select_on_container_copy_construction(other)} {
+  reserve(other.size_);
+  for (const auto& value : other) {
+    // Keys are known to be unique, skip the lookup
+    auto hash = hash_(value.first);
+    auto index = find_free_(hash);
+    set_ctrl_(index, h2_(hash));
+    AllocTraits::construct(*static_cast<Alloc*>(this), slots_ + index, value);
+    --growth_left_;
+    ++size_;
+  }
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+FlatHashMap<K, V, Hash, KeyEqual, Alloc>::FlatHashMap(FlatHashMap&& other) noexcept
+    : Hash{std::move(other)},
+      KeyEqual{std::move(other)},
+      Alloc{std::move(other)},
+      ctrl_{std::exchange(other.ctrl_, nullptr)},
+      slots_{std::exchange(other.slots_, nullptr)},
+      capacity_{std::exchange(other.capacity_, 0)},
+      size_{std::exchange(other.size_, 0)},
+      growth_left_{std::exchange(other.growth_left_, 0)} {}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+FlatHashMap<K, V, Hash, KeyEqual, Alloc>& FlatHashMap<K, V, Hash, KeyEqual, Alloc>::operator=(FlatHashMap other) {
+  // Copy-and-swap, the allocator travels with the table
+  using std::swap;
+  swap(static_cast<Hash&>(*this), static_cast<Hash&>(other));
+  swap(static_cast<KeyEqual&>(*this), static_cast<KeyEqual&>(other));
+  swap(static_cast<Alloc&>(*this), static_cast<Alloc&>(other));
+  swap(ctrl_, other.ctrl_);
+  swap(slots_, other.slots_);
+  swap(capacity_, other.capacity_);
+  swap(size_, other.size_);
+  swap(growth_left_, other.growth_left_);
+  return *this;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+FlatHashMap<K, V, Hash, KeyEqual, Alloc>::~FlatHashMap() {
+  destroy_elements_();
+  deallocate_();
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+void FlatHashMap<K, V, Hash, KeyEqual, Alloc>::clear() noexcept {
+  destroy_elements_();
+  if (capacity_ != 0) {
+    std::fill_n(ctrl_, capacity_ + Group::kWidth, kEmpty);
+    growth_left_ = max_load_(capacity_);
+  }
+  size_ = 0;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+void FlatHashMap<K, V, Hash, KeyEqual, Alloc>::reserve(std::size_t count) {
+  if (count <= size_ + growth_left_) {
+    return;
+  }
+
+  std::size_t capacity = Group::kWidth;
+  while (max_load_(capacity) < count) {
+    capacity <<= 1;
+  }
+  resize_(capacity);
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+V& FlatHashMap<K, V, Hash, KeyEqual, Alloc>::at(const K& key) {
+  auto index = find_index_(key);
+  if (index == capacity_) {
+    throw std::out_of_range("FlatHashMap::at");
+  }
+  return slots_[index].second;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+const V& FlatHashMap<K, V, Hash, KeyEqual, Alloc>::at(const K& key) const {
+  auto index = find_index_(key);
+  if (index == capacity_) {
+    throw std::out_of_range("FlatHashMap::at");
+  }
+  return slots_[index].second;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+template <typename Key, typename... Args>
+std::pair<typename FlatHashMap<K, V, Hash, KeyEqual, Alloc>::iterator, bool> FlatHashMap<K, V, Hash, KeyEqual, Alloc>::try_emplace(Key&& key,
+                                                                                                                                  Args&&... args) {
+  auto [index, inserted] = find_or_prepare_insert_(key);
+  if (inserted) {
+    AllocTraits::construct(*static_cast<Alloc*>(this), slots_ + index, std::piecewise_construct, std::forward_as_tuple(std::forward<Key>(key)),
+                           std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+  return {iterator(this, index), inserted};
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+template <typename Key, typename M>
+std::pair<typename FlatHashMap<K, V, Hash, KeyEqual, Alloc>::iterator, bool> FlatHashMap<K, V, Hash, KeyEqual, Alloc>::insert_or_assign(Key&& key,
+                                                                                                                                       M&& value) {
+  auto result = try_emplace(std::forward<Key>(key), std::forward<M>(value));
+  if (!result.second) {
+    result.first->second = std::forward<M>(value);
+  }
+  return result;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+template <typename... Args>
+std::pair<typename FlatHashMap<K, V, Hash, KeyEqual, Alloc>::iterator, bool> FlatHashMap<K, V, Hash, KeyEqual, Alloc>::emplace(Args&&... args) {
+  // The key is only known once the pair exists
+  value_type value(std::forward<Args>(args)...);
+  return try_emplace(std::move(const_cast<K&>(value.first)), std::move(value.second));
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+typename FlatHashMap<K, V, Hash, KeyEqual, Alloc>::iterator FlatHashMap<K, V, Hash, KeyEqual, Alloc>::erase(const_iterator it) {
+  erase_index_(it.index_);
+  return {this, it.index_ + 1};
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+template <typename Key>
+std::size_t FlatHashMap<K, V, Hash, KeyEqual, Alloc>::find_index_(const Key& key) const {
+  if (capacity_ == 0) {
+    return capacity_;
+  }
+
+  auto hash = hash_(key);
+  auto h2 = h2_(hash);
+  auto mask = capacity_ - 1;
+
+  // Triangular probing over groups visits every group once when the capacity is a power of two
+  auto pos = h1_(hash) & mask;
+  for (std::size_t step = Group::kWidth;; step += Group::kWidth) {
+    Group group(ctrl_ + pos);
+    for (auto match = group.match(h2); match; match.pop_lowest()) {
+      auto index = (pos + match.lowest()) & mask;
+      if (KeyEqual::operator()(slots_[index].first, key)) {
+        return index;
+      }
+    }
+    if (group.match_empty()) {
+      return capacity_;
+    }
+    pos = (pos + step) & mask;
+  }
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+std::size_t FlatHashMap<K, V, Hash, KeyEqual, Alloc>::find_free_(std::size_t hash) const noexcept {
+  auto mask = capacity_ - 1;
+  auto pos = h1_(hash) & mask;
+  for (std::size_t step = Group::kWidth;; step += Group::kWidth) {
+    auto free = Group(ctrl_ + pos).match_empty_or_deleted();
+    if (free) {
+      return (pos + free.lowest()) & mask;
+    }
+    pos = (pos + step) & mask;
+  }
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+template <typename Key>
+std::pair<std::size_t, bool> FlatHashMap<K, V, Hash, KeyEqual, Alloc>::find_or_prepare_insert_(const Key& key) {
+  auto index = find_index_(key);
+  if (index != capacity_) {
+    return {index, false};
+  }
+
+  auto hash = hash_(key);
+  index = capacity_ == 0 ? 0 : find_free_(hash);
+  // Reusing a deleted slot does not consume growth
+  if (capacity_ == 0 || (growth_left_ == 0 && ctrl_[index] == kEmpty)) {
+    // Mostly tombstones: rehash in place, otherwise double
+    resize_(capacity_ == 0 ? Group::kWidth : size_ * 2 < max_load_(capacity_) ? capacity_ : capacity_ * 2);
+    index = find_free_(hash);
+  }
+
+  if (ctrl_[index] == kEmpty) {
+    --growth_left_;
+  }
+  set_ctrl_(index, h2_(hash));
+  ++size_;
+  return {index, true};
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+void FlatHashMap<K, V, Hash, KeyEqual, Alloc>::set_ctrl_(std::size_t index, ctrl_t value) noexcept {
+  ctrl_[index] = value;
+  // Mirror the head of the table past its end, so that a group loaded near the end wraps around
+  if (index < Group::kWidth) {
+    ctrl_[capacity_ + index] = value;
+  }
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+void FlatHashMap<K, V, Hash, KeyEqual, Alloc>::erase_index_(std::size_t index) noexcept {
+  AllocTraits::destroy(*static_cast<Alloc*>(this), slots_ + index);
+  --size_;
+
+  // A slot can become empty again when no probe sequence ever ran across it: the group that starts at it and
+  // the group that ends at it must have seen an empty byte within one group width.
+  auto mask = capacity_ - 1;
+  auto empty_after = Group(ctrl_ + index).match_empty();
+  auto empty_before = Group(ctrl_ + ((index - Group::kWidth) & mask)).match_empty();
+  if (empty_after && empty_before) {
+    std::size_t free_after = empty_after.lowest();
+    std::size_t free_before = 0;
+    for (auto bits = empty_before; bits; bits.pop_lowest()) {
+      free_before = Group::kWidth - 1 - bits.lowest();
+    }
+    if (free_after + free_before < Group::kWidth) {
+      set_ctrl_(index, kEmpty);
+      ++growth_left_;
+      return;
+    }
+  }
+  set_ctrl_(index, kDeleted);
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+void FlatHashMap<K, V, Hash, KeyEqual, Alloc>::resize_(std::size_t capacity) {
+  auto old_ctrl = ctrl_;
+  auto old_slots = slots_;
+  auto old_capacity = capacity_;
+
+  allocate_(capacity);
+  for (std::size_t i = 0; i < old_capacity; ++i) {
+    if (old_ctrl[i] < 0) {
+      continue;
+    }
+
+    auto hash = hash_(old_slots[i].first);
+    auto index = find_free_(hash);
+    set_ctrl_(index, h2_(hash));
+    // Keys are const in value_type, so elements are moved through a copy of the key
+    AllocTraits::construct(*static_cast<Alloc*>(this), slots_ + index, std::move(const_cast<K&>(old_slots[i].first)), std::move(old_slots[i].second));
+    AllocTraits::destroy(*static_cast<Alloc*>(this), old_slots + i);
+  }
+  growth_left_ = max_load_(capacity_) - size_;
+
+  if (old_capacity != 0) {
+    CtrlAlloc ctrl_alloc{*static_cast<Alloc*>(this)};
+    CtrlAllocTraits::deallocate(ctrl_alloc, old_ctrl, old_capacity + Group::kWidth);
+    AllocTraits::deallocate(*static_cast<Alloc*>(this), old_slots, old_capacity);
+  }
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+void FlatHashMap<K, V, Hash, KeyEqual, Alloc>::allocate_(std::size_t capacity) {
+  assert(std::has_single_bit(capacity) && capacity >= Group::kWidth);
+  CtrlAlloc ctrl_alloc{*static_cast<Alloc*>(this)};
+  ctrl_ = CtrlAllocTraits::allocate(ctrl_alloc, capacity + Group::kWidth);
+  std::fill_n(ctrl_, capacity + Group::kWidth, kEmpty);
+  slots_ = AllocTraits::allocate(*static_cast<Alloc*>(this), capacity);
+  capacity_ = capacity;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+void FlatHashMap<K, V, Hash, KeyEqual, Alloc>::deallocate_() noexcept {
+  if (capacity_ == 0) {
+    return;
+  }
+
+  CtrlAlloc ctrl_alloc{*static_cast<Alloc*>(this)};
+  CtrlAllocTraits::deallocate(ctrl_alloc, ctrl_, capacity_ + Group::kWidth);
+  AllocTraits::deallocate(*static_cast<Alloc*>(this), slots_, capacity_);
+  ctrl_ = nullptr;
+  slots_ = nullptr;
+  capacity_ = 0;
+  growth_left_ = 0;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Alloc>
+void FlatHashMap<K, V, Hash, KeyEqual, Alloc>::destroy_elements_() noexcept {
+  if constexpr (!std::is_trivially_destructible_v<value_type>) {
+    for (std::size_t i = 0; i < capacity_; ++i) {
+      if (ctrl_[i] >= 0) {
+        AllocTraits::destroy(*static_cast<Alloc*>(this), slots_ + i);
+      }
+    }
+  }
+}
+}  // namespace nyx::data_structure
+
+#endif  // !DATA_STRUCTURE_FLAT_HASH_MAP_HPP
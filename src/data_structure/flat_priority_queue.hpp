@@ -0,0 +1,266 @@
+#ifndef DATA_STRUCTURE_FLAT_PRIORITY_QUEUE_HPP
+#define DATA_STRUCTURE_FLAT_PRIORITY_QUEUE_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "src/data_structure/hierarchical_bitmap.hpp"
+#include "src/data_structure/slot_index.hpp"
+
+namespace nyx::data_structure {
+// Same interface as hierarchical_priority_queue, without a heap allocation per element.
+// Elements live in a contiguous slab of slots; each priority level is an intrusive list of slot ids and
+// a SlotIndex maps an element to its slot. Freed slots are recycled, so once the slab and the
+// table reached their peak size (or after reserve()), push, update, remove and pop do not allocate.
+template <typename T, std::size_t Levels = 4096, typename Hash = std::hash<T>>
+class flat_priority_queue : private Hash {
+ public:
+  typedef std::conditional_t<(Levels <= 256), std::uint8_t, std::conditional_t<(Levels <= 65536), std::uint16_t, std::uint32_t>> priority_t;
+
+ private:
+  static constexpr std::uint32_t kNil = SlotIndex::npos;
+
+  struct Slot {
+    T value;
+    std::uint32_t prev;
+    std::uint32_t next;  // next free slot while the slot is unused
+    std::uint32_t hash;
+    priority_t priority;
+  };
+
+  struct Bucket {
+    std::uint32_t head{kNil};
+    std::uint32_t tail{kNil};
+  };
+
+  std::vector<Slot> slots_;
+  std::vector<Bucket> buckets_;
+  SlotIndex index_;
+  std::uint32_t free_head_{kNil};
+  std::size_t size_{0};
+  HierarchicalBitmap<Levels> marker_;
+
+ public:
+  explicit flat_priority_queue(std::size_t capacity = 0);
+
+  flat_priority_queue(const flat_priority_queue&) = delete;
+  flat_priority_queue& operator=(const flat_priority_queue&) = delete;
+
+ public:
+  static constexpr std::size_t levels() noexcept { return Levels; }
+
+  // Makes room for capacity elements in both the slab and the index.
+  void reserve(std::size_t capacity);
+
+  bool is_exsit(const T&) const noexcept;
+  // Undefined when the queue is empty.
+  const T& top() const noexcept;
+  std::optional<priority_t> top_priority() const noexcept;
+  void push_no_update(T&&, const priority_t&);
+  void push_and_update(T&&, const priority_t&);
+  bool try_pop(T&) noexcept;
+  void remove(const T&) noexcept;
+  std::optional<priority_t> get_priority(const T&) const noexcept;
+  void clear() noexcept;
+  size_t size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+ private:
+  std::uint32_t hash_(const T& value) const noexcept { return SlotIndex::spread(Hash::operator()(value)); }
+  // Slot holding value, or kNil
+  std::uint32_t find_(const T& value, std::uint32_t hash) const noexcept {
+    return index_.find(hash, [this, &value](std::uint32_t slot) { return slots_[slot].value == value; });
+  }
+
+  std::uint32_t allocate_slot_(T&&);
+  void free_slot_(std::uint32_t) noexcept;
+  void link_(std::uint32_t, const priority_t&) noexcept;
+  void unlink_(std::uint32_t) noexcept;
+};
+
+template <typename T, std::size_t Levels, typename Hash>
+flat_priority_queue<T, Levels, Hash>::flat_priority_queue(std::size_t capacity) : buckets_(Levels) {
+  reserve(capacity);
+}
+
+template <typename T, std::size_t Levels, typename Hash>
+void flat_priority_queue<T, Levels, Hash>::reserve(std::size_t capacity) {
+  assert(capacity < kNil);
+  slots_.reserve(capacity);
+  index_.reserve(capacity);
+}
+
+template <typename T, std::size_t Levels, typename Hash>
+bool flat_priority_queue<T, Levels, Hash>::is_exsit(const T& value) const noexcept {
+  return find_(value, hash_(value)) != kNil;
+}
+
+template <typename T, std::size_t Levels, typename Hash>
+const T& flat_priority_queue<T, Levels, Hash>::top() const noexcept {
+  assert(!empty());
+  return slots_[buckets_[marker_.highest()].head].value;
+}
+
+template <typename T, std::size_t Levels, typename Hash>
+std::optional<typename flat_priority_queue<T, Levels, Hash>::priority_t> flat_priority_queue<T, Levels, Hash>::top_priority() const noexcept {
+  if (empty()) {
+    return std::nullopt;
+  }
+
+  return static_cast<priority_t>(marker_.highest());
+}
+
+template <typename T, std::size_t Levels, typename Hash>
+void flat_priority_queue<T, Levels, Hash>::push_no_update(T&& value, const priority_t& priority) {
+  assert(priority < Levels);
+  auto hash = hash_(value);
+  if (find_(value, hash) != kNil) {
+    return;
+  }
+
+  index_.reserve(size_ + 1);
+  auto slot = allocate_slot_(std::forward<T>(value));
+  slots_[slot].hash = hash;
+  index_.insert(slot, hash);
+  link_(slot, priority);
+}
+
+template <typename T, std::size_t Levels, typename Hash>
+void flat_priority_queue<T, Levels, Hash>::push_and_update(T&& value, const priority_t& priority) {
+  assert(priority < Levels);
+  auto hash = hash_(value);
+  auto slot = find_(value, hash);
+  if (slot == kNil) {
+    push_no_update(std::forward<T>(value), priority);
+    return;
+  }
+
+  // Priority not changed
+  if (slots_[slot].priority == priority) {
+    return;
+  }
+
+  unlink_(slot);
+  link_(slot, priority);
+}
+
+template <typename T, std::size_t Levels, typename Hash>
+bool flat_priority_queue<T, Levels, Hash>::try_pop(T& out) noexcept {
+  if (marker_.empty()) {
+    return false;
+  }
+
+  auto slot = buckets_[marker_.highest()].head;
+  unlink_(slot);
+  index_.erase(slot, slots_[slot].hash);
+  out = std::move(slots_[slot].value);
+  free_slot_(slot);
+
+  return true;
+}
+
+template <typename T, std::size_t Levels, typename Hash>
+void flat_priority_queue<T, Levels, Hash>::remove(const T& value) noexcept {
+  auto slot = find_(value, hash_(value));
+  if (slot == kNil) {
+    return;
+  }
+
+  unlink_(slot);
+  index_.erase(slot, slots_[slot].hash);
+  free_slot_(slot);
+}
+
+template <typename T, std::size_t Levels, typename Hash>
+std::optional<typename flat_priority_queue<T, Levels, Hash>::priority_t> flat_priority_queue<T, Levels, Hash>::get_priority(
+    const T& value) const noexcept {
+  auto slot = find_(value, hash_(value));
+  if (slot == kNil) {
+    return std::nullopt;
+  }
+
+  return slots_[slot].priority;
+}
+
+template <typename T, std::size_t Levels, typename Hash>
+void flat_priority_queue<T, Levels, Hash>::clear() noexcept {
+  // Only the non-empty levels need clearing
+  for (auto priority = marker_.highest(); priority != marker_.npos; priority = marker_.highest()) {
+    buckets_[priority] = Bucket{};
+    marker_.reset(priority);
+  }
+
+  // Capacity is kept
+  slots_.clear();
+  index_.clear();
+  free_head_ = kNil;
+  size_ = 0;
+}
+
+template <typename T, std::size_t Levels, typename Hash>
+std::uint32_t flat_priority_queue<T, Levels, Hash>::allocate_slot_(T&& value) {
+  ++size_;
+  if (free_head_ == kNil) {
+    slots_.push_back(Slot{std::forward<T>(value), kNil, kNil, 0, 0});
+    return static_cast<std::uint32_t>(slots_.size() - 1);
+  }
+
+  auto slot = free_head_;
+  free_head_ = slots_[slot].next;
+  slots_[slot].value = std::forward<T>(value);
+  return slot;
+}
+
+template <typename T, std::size_t Levels, typename Hash>
+void flat_priority_queue<T, Levels, Hash>::free_slot_(std::uint32_t slot) noexcept {
+  --size_;
+  slots_[slot].next = free_head_;
+  free_head_ = slot;
+}
+
+template <typename T, std::size_t Levels, typename Hash>
+void flat_priority_queue<T, Levels, Hash>::link_(std::uint32_t slot, const priority_t& priority) noexcept {
+  auto& bucket = buckets_[priority];
+  auto& node = slots_[slot];
+  node.priority = priority;
+  node.prev = bucket.tail;
+  node.next = kNil;
+
+  if (bucket.tail == kNil) {
+    bucket.head = slot;
+    marker_.set(priority);
+  } else {
+    slots_[bucket.tail].next = slot;
+  }
+  bucket.tail = slot;
+}
+
+template <typename T, std::size_t Levels, typename Hash>
+void flat_priority_queue<T, Levels, Hash>::unlink_(std::uint32_t slot) noexcept {
+  auto& bucket = buckets_[slots_[slot].priority];
+  auto& node = slots_[slot];
+
+  if (node.prev == kNil) {
+    bucket.head = node.next;
+  } else {
+    slots_[node.prev].next = node.next;
+  }
+  if (node.next == kNil) {
+    bucket.tail = node.prev;
+  } else {
+    slots_[node.next].prev = node.prev;
+  }
+
+  if (bucket.head == kNil) {
+    marker_.reset(node.priority);
+  }
+}
+}  // namespace nyx::data_structure
+
+#endif  // !DATA_STRUCTURE_FLAT_PRIORITY_QUEUE_HPP
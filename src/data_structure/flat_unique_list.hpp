@@ -0,0 +1,264 @@
+#ifndef DATA_STRUCTURE_FLAT_UNIQUE_LIST_HPP
+#define DATA_STRUCTURE_FLAT_UNIQUE_LIST_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "src/data_structure/slot_index.hpp"
+
+namespace nyx {
+namespace data_structure {
+
+// UniqueList storing every element once. Elements live in a contiguous vector of slots linked by 32-bit
+// prev/next indices, and a SlotIndex maps an element to its slot. Freed slots are recycled, so a list
+// that is only pushed back iterates sequentially through memory.
+template <typename T, typename Hash = std::hash<T>>
+class FlatUniqueList : private Hash {
+ public:
+  enum REPLACE_RESULT {
+    SUCCESS = 0,
+    DUPLICATE_HASH,
+    KEY_NOT_FOUND,
+  };
+
+ private:
+  static constexpr std::uint32_t kNil = SlotIndex::npos;
+
+  struct Slot {
+    T value;
+    std::uint32_t prev;
+    std::uint32_t next;  // next free slot while the slot is unused
+    std::uint32_t hash;
+  };
+
+  std::vector<Slot> slots_;
+  SlotIndex index_;
+  std::uint32_t head_{kNil};
+  std::uint32_t tail_{kNil};
+  std::uint32_t free_head_{kNil};
+  std::size_t size_{0};
+
+ public:
+  template <typename List, typename Value>
+  class Iterator {
+    friend class FlatUniqueList;
+    template <typename, typename>
+    friend class Iterator;
+
+    List* list_;
+    std::uint32_t slot_;
+
+    Iterator(List* list, std::uint32_t slot) : list_(list), slot_(slot) {}
+
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value*;
+    using reference = Value&;
+
+    Iterator() : list_(nullptr), slot_(kNil) {}
+    // iterator converts to const_iterator
+    operator Iterator<const List, const Value>() const { return {list_, slot_}; }
+
+    reference operator*() const { return list_->slots_[slot_].value; }
+    pointer operator->() const { return &list_->slots_[slot_].value; }
+
+    Iterator& operator++() {
+      slot_ = list_->slots_[slot_].next;
+      return *this;
+    }
+    Iterator operator++(int) {
+      auto copy = *this;
+      ++*this;
+      return copy;
+    }
+    Iterator& operator--() {
+      slot_ = slot_ == kNil ? list_->tail_ : list_->slots_[slot_].prev;
+      return *this;
+    }
+    Iterator operator--(int) {
+      auto copy = *this;
+      --*this;
+      return copy;
+    }
+
+    bool operator==(const Iterator& other) const { return slot_ == other.slot_; }
+  };
+
+  using iterator = Iterator<FlatUniqueList, T>;
+  using const_iterator = Iterator<const FlatUniqueList, const T>;
+
+ public:
+  FlatUniqueList() {}
+  explicit FlatUniqueList(const std::vector<T>&);
+  ~FlatUniqueList() {}
+
+  FlatUniqueList(const FlatUniqueList&) = default;
+  FlatUniqueList& operator=(const FlatUniqueList&) = default;
+
+ public:
+  void reserve(std::size_t);
+
+  bool push_back(const T&);
+  bool pop_back(T&);
+  bool pop(const T&);
+  bool contain(const T&) const;
+  REPLACE_RESULT replace(const T&, const T&);
+
+  bool empty() const { return size_ == 0; }
+  size_t size() const { return size_; }
+
+  iterator begin() { return {this, head_}; }
+  iterator end() { return {this, kNil}; }
+  const_iterator begin() const { return {this, head_}; }
+  const_iterator end() const { return {this, kNil}; }
+  std::optional<const_iterator> try_get_node(const T&) const;
+
+ private:
+  std::uint32_t hash_(const T& value) const noexcept { return SlotIndex::spread(Hash::operator()(value)); }
+  // Slot holding value, or kNil
+  std::uint32_t find_(const T& value, std::uint32_t hash) const noexcept {
+    return index_.find(hash, [this, &value](std::uint32_t slot) { return slots_[slot].value == value; });
+  }
+
+  void unlink_(std::uint32_t) noexcept;
+};
+
+template <typename T, typename Hash>
+FlatUniqueList<T, Hash>::FlatUniqueList(const std::vector<T>& other) : FlatUniqueList() {
+  reserve(other.size());
+  for (const auto& it : other) {
+    push_back(it);
+  }
+}
+
+template <typename T, typename Hash>
+void FlatUniqueList<T, Hash>::reserve(std::size_t capacity) {
+  assert(capacity < kNil);
+  slots_.reserve(capacity);
+  index_.reserve(capacity);
+}
+
+template <typename T, typename Hash>
+bool FlatUniqueList<T, Hash>::push_back(const T& value) {
+  auto hash = hash_(value);
+  if (find_(value, hash) != kNil) {
+    return false;
+  }
+
+  index_.reserve(size_ + 1);
+
+  std::uint32_t slot = free_head_;
+  if (slot == kNil) {
+    slot = static_cast<std::uint32_t>(slots_.size());
+    slots_.push_back(Slot{value, tail_, kNil, hash});
+  } else {
+    free_head_ = slots_[slot].next;
+    slots_[slot] = Slot{value, tail_, kNil, hash};
+  }
+
+  if (tail_ == kNil) {
+    head_ = slot;
+  } else {
+    slots_[tail_].next = slot;
+  }
+  tail_ = slot;
+  ++size_;
+
+  index_.insert(slot, hash);
+  return true;
+}
+
+template <typename T, typename Hash>
+bool FlatUniqueList<T, Hash>::pop_back(T& out) {
+  if (tail_ == kNil) {
+    return false;
+  }
+
+  auto slot = tail_;
+  index_.erase(slot, slots_[slot].hash);
+  unlink_(slot);
+  out = std::move(slots_[slot].value);
+
+  return true;
+}
+
+template <typename T, typename Hash>
+bool FlatUniqueList<T, Hash>::pop(const T& key) {
+  auto slot = find_(key, hash_(key));
+  if (slot == kNil) {
+    return false;
+  }
+
+  index_.erase(slot, slots_[slot].hash);
+  unlink_(slot);
+
+  return true;
+}
+
+template <typename T, typename Hash>
+bool FlatUniqueList<T, Hash>::contain(const T& key) const {
+  return find_(key, hash_(key)) != kNil;
+}
+
+template <typename T, typename Hash>
+FlatUniqueList<T, Hash>::REPLACE_RESULT FlatUniqueList<T, Hash>::replace(const T& value, const T& replace_value) {
+  auto slot = find_(value, hash_(value));
+  if (slot == kNil) {
+    return KEY_NOT_FOUND;
+  }
+
+  auto value_hashed = Hash::operator()(value), replace_value_hashed = Hash::operator()(replace_value);
+  if (value_hashed == replace_value_hashed || contain(replace_value)) {
+    return DUPLICATE_HASH;
+  }
+
+  // Element keeps its slot and its place in the list, only its index entry moves
+  index_.erase(slot, slots_[slot].hash);
+  slots_[slot].value = replace_value;
+  slots_[slot].hash = hash_(replace_value);
+  index_.insert(slot, slots_[slot].hash);
+
+  return SUCCESS;
+}
+
+template <typename T, typename Hash>
+std::optional<typename FlatUniqueList<T, Hash>::const_iterator> FlatUniqueList<T, Hash>::try_get_node(const T& key) const {
+  auto slot = find_(key, hash_(key));
+  if (slot == kNil) {
+    return std::nullopt;
+  }
+
+  return const_iterator{this, slot};
+}
+
+template <typename T, typename Hash>
+void FlatUniqueList<T, Hash>::unlink_(std::uint32_t slot) noexcept {
+  auto& node = slots_[slot];
+  if (node.prev == kNil) {
+    head_ = node.next;
+  } else {
+    slots_[node.prev].next = node.next;
+  }
+  if (node.next == kNil) {
+    tail_ = node.prev;
+  } else {
+    slots_[node.next].prev = node.prev;
+  }
+
+  node.next = free_head_;
+  free_head_ = slot;
+  --size_;
+}
+
+}  // namespace data_structure
+}  // namespace nyx
+
+#endif  // !DATA_STRUCTURE_FLAT_UNIQUE_LIST_HPP
@@ -0,0 +1,113 @@
+#ifndef DATA_STRUCTURE_HIERARCHICAL_BITMAP_HPP
+#define DATA_STRUCTURE_HIERARCHICAL_BITMAP_HPP
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace nyx::data_structure {
+// Fixed-size bitmap with up to three levels of summary words. Bit i of a summary word is set iff word i
+// of the level below is non-zero, so highest()/lowest() are one bit-scan per level.
+template <std::size_t Bits>
+class HierarchicalBitmap {
+  static constexpr std::size_t kWordBits = 64;
+  static constexpr std::size_t kMaxBits = kWordBits * kWordBits * kWordBits;
+  static_assert(Bits > 0 && Bits <= kMaxBits, "HierarchicalBitmap supports up to 64^3 bits");
+
+  static constexpr std::size_t words_for_(std::size_t bits) { return (bits + kWordBits - 1) / kWordBits; }
+
+  // Level 0 holds the bits themselves, the last level is a single word
+  static constexpr std::size_t kLevels = Bits <= kWordBits ? 1 : Bits <= kWordBits * kWordBits ? 2 : 3;
+  static constexpr std::array<std::size_t, 3> kLevelWords{words_for_(Bits), words_for_(words_for_(Bits)), 1};
+  static constexpr std::array<std::size_t, 3> kLevelOffset{0, kLevelWords[0], kLevelWords[0] + kLevelWords[1]};
+  static constexpr std::size_t kTotalWords = kLevelOffset[kLevels - 1] + 1;
+
+  std::array<std::uint64_t, kTotalWords> words_{};
+
+ public:
+  static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+  static constexpr std::size_t bits() noexcept { return Bits; }
+
+  bool empty() const noexcept { return root_() == 0; }
+  bool test(std::size_t) const noexcept;
+  void set(std::size_t) noexcept;
+  void reset(std::size_t) noexcept;
+  void clear() noexcept { words_.fill(0); }
+
+  // Index of the highest/lowest set bit, npos when empty.
+  std::size_t highest() const noexcept;
+  std::size_t lowest() const noexcept;
+
+ private:
+  std::uint64_t root_() const noexcept { return words_[kLevelOffset[kLevels - 1]]; }
+  static std::uint64_t mask_(std::size_t index) noexcept { return std::uint64_t{1} << (index % kWordBits); }
+};
+
+template <std::size_t Bits>
+bool HierarchicalBitmap<Bits>::test(std::size_t index) const noexcept {
+  assert(index < Bits);
+  return (words_[index / kWordBits] & mask_(index)) != 0;
+}
+
+template <std::size_t Bits>
+void HierarchicalBitmap<Bits>::set(std::size_t index) noexcept {
+  assert(index < Bits);
+  for (std::size_t level = 0; level < kLevels; ++level) {
+    auto& word = words_[kLevelOffset[level] + index / kWordBits];
+    bool was_empty = word == 0;
+    word |= mask_(index);
+    // Summary bits above are already set
+    if (!was_empty) {
+      return;
+    }
+    index /= kWordBits;
+  }
+}
+
+template <std::size_t Bits>
+void HierarchicalBitmap<Bits>::reset(std::size_t index) noexcept {
+  assert(index < Bits);
+  for (std::size_t level = 0; level < kLevels; ++level) {
+    auto& word = words_[kLevelOffset[level] + index / kWordBits];
+    word &= ~mask_(index);
+    // Other bits keep the summary bits above alive
+    if (word != 0) {
+      return;
+    }
+    index /= kWordBits;
+  }
+}
+
+template <std::size_t Bits>
+std::size_t HierarchicalBitmap<Bits>::highest() const noexcept {
+  if (empty()) {
+    return npos;
+  }
+
+  std::size_t index = 0;
+  for (std::size_t level = kLevels; level-- > 0;) {
+    auto word = words_[kLevelOffset[level] + index];
+    index = index * kWordBits + (kWordBits - 1 - std::countl_zero(word));
+  }
+  return index;
+}
+
+template <std::size_t Bits>
+std::size_t HierarchicalBitmap<Bits>::lowest() const noexcept {
+  if (empty()) {
+    return npos;
+  }
+
+  std::size_t index = 0;
+  for (std::size_t level = kLevels; level-- > 0;) {
+    auto word = words_[kLevelOffset[level] + index];
+    index = index * kWordBits + std::countr_zero(word);
+  }
+  return index;
+}
+}  // namespace nyx::data_structure
+
+#endif  // !DATA_STRUCTURE_HIERARCHICAL_BITMAP_HPP
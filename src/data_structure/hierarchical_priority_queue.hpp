@@ -0,0 +1,181 @@
+#ifndef DATA_STRUCTURE_HIERARCHICAL_PRIORITY_QUEUE_HPP
+#define DATA_STRUCTURE_HIERARCHICAL_PRIORITY_QUEUE_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "src/data_structure/hierarchical_bitmap.hpp"
+
+namespace nyx::data_structure {
+// Same interface as priority_queue, but the priority range is only bounded by Levels (up to 64^3).
+// Non-empty levels are tracked by a HierarchicalBitmap, the highest one is found with one bit-scan per
+// bitmap level. Elements of the same priority pop in FIFO order.
+template <typename T, std::size_t Levels = 4096>
+class hierarchical_priority_queue {
+ public:
+  typedef std::conditional_t<(Levels <= 256), std::uint8_t, std::conditional_t<(Levels <= 65536), std::uint16_t, std::uint32_t>> priority_t;
+  typedef typename std::list<T>::iterator node_addr_t;
+  typedef std::pair<priority_t, node_addr_t> node_container_t;
+  typedef typename std::unordered_map<T, node_container_t> addr_map_t;
+
+ private:
+  addr_map_t addr_map_;
+  std::vector<std::list<T>> priorities_;
+  HierarchicalBitmap<Levels> marker_;
+
+ public:
+  hierarchical_priority_queue() : priorities_(Levels) {}
+
+  hierarchical_priority_queue(const hierarchical_priority_queue&) = delete;
+  hierarchical_priority_queue& operator=(const hierarchical_priority_queue&) = delete;
+
+ public:
+  static constexpr std::size_t levels() noexcept { return Levels; }
+
+  bool is_exsit(const T&) const noexcept;
+  // Undefined when the queue is empty.
+  const T& top() const noexcept;
+  std::optional<priority_t> top_priority() const noexcept;
+  void push_no_update(T&&, const priority_t&) noexcept;
+  void push_and_update(T&&, const priority_t&) noexcept;
+  bool try_pop(T&) noexcept;
+  void remove(const T&) noexcept;
+  std::optional<priority_t> get_priority(const T&) const noexcept;
+  void clear() noexcept;
+  size_t size() const noexcept;
+  bool empty() const noexcept { return marker_.empty(); }
+
+ private:
+  void unlink_(const node_container_t&) noexcept;
+  void link_(T&&, const priority_t&, node_container_t&) noexcept;
+};
+
+template <typename T, std::size_t Levels>
+bool hierarchical_priority_queue<T, Levels>::is_exsit(const T& value) const noexcept {
+  return addr_map_.find(value) != addr_map_.end();
+}
+
+template <typename T, std::size_t Levels>
+const T& hierarchical_priority_queue<T, Levels>::top() const noexcept {
+  assert(!empty());
+  return priorities_[marker_.highest()].front();
+}
+
+template <typename T, std::size_t Levels>
+std::optional<typename hierarchical_priority_queue<T, Levels>::priority_t> hierarchical_priority_queue<T, Levels>::top_priority() const noexcept {
+  if (empty()) {
+    return std::nullopt;
+  }
+
+  return static_cast<priority_t>(marker_.highest());
+}
+
+template <typename T, std::size_t Levels>
+void hierarchical_priority_queue<T, Levels>::push_no_update(T&& value, const priority_t& priority) noexcept {
+  assert(priority < Levels);
+  auto [it, inserted] = addr_map_.try_emplace(value);
+  if (!inserted) {
+    return;
+  }
+  link_(std::forward<T>(value), priority, it->second);
+}
+
+template <typename T, std::size_t Levels>
+void hierarchical_priority_queue<T, Levels>::push_and_update(T&& value, const priority_t& priority) noexcept {
+  assert(priority < Levels);
+  auto [it, inserted] = addr_map_.try_emplace(value);
+  if (!inserted) {
+    // Priority not changed
+    if (it->second.first == priority) {
+      return;
+    }
+    unlink_(it->second);
+  }
+  link_(std::forward<T>(value), priority, it->second);
+}
+
+template <typename T, std::size_t Levels>
+bool hierarchical_priority_queue<T, Levels>::try_pop(T& out) noexcept {
+  if (marker_.empty()) {
+    return false;
+  }
+
+  auto highest_priority = marker_.highest();
+  auto& prio_list = priorities_[highest_priority];
+  out = std::move(prio_list.front());
+  prio_list.pop_front();
+  addr_map_.erase(out);
+
+  if (prio_list.empty()) {
+    marker_.reset(highest_priority);
+  }
+
+  return true;
+}
+
+template <typename T, std::size_t Levels>
+void hierarchical_priority_queue<T, Levels>::remove(const T& value) noexcept {
+  auto it = addr_map_.find(value);
+  if (it == addr_map_.end()) {
+    return;
+  }
+
+  unlink_(it->second);
+  addr_map_.erase(it);
+}
+
+template <typename T, std::size_t Levels>
+std::optional<typename hierarchical_priority_queue<T, Levels>::priority_t> hierarchical_priority_queue<T, Levels>::get_priority(
+    const T& value) const noexcept {
+  auto it = addr_map_.find(value);
+  if (it == addr_map_.end()) {
+    return std::nullopt;
+  }
+
+  return it->second.first;
+}
+
+template <typename T, std::size_t Levels>
+void hierarchical_priority_queue<T, Levels>::clear() noexcept {
+  // Only the non-empty levels need clearing
+  for (auto priority = marker_.highest(); priority != marker_.npos; priority = marker_.highest()) {
+    priorities_[priority].clear();
+    marker_.reset(priority);
+  }
+  addr_map_.clear();
+}
+
+template <typename T, std::size_t Levels>
+size_t hierarchical_priority_queue<T, Levels>::size() const noexcept {
+  return addr_map_.size();
+}
+
+template <typename T, std::size_t Levels>
+void hierarchical_priority_queue<T, Levels>::unlink_(const node_container_t& nc) noexcept {
+  auto& prio_list = priorities_[nc.first];
+  prio_list.erase(nc.second);
+  if (prio_list.empty()) {
+    marker_.reset(nc.first);
+  }
+}
+
+template <typename T, std::size_t Levels>
+void hierarchical_priority_queue<T, Levels>::link_(T&& value, const priority_t& priority, node_container_t& nc) noexcept {
+  auto& prio_list = priorities_[priority];
+  if (prio_list.empty()) {
+    marker_.set(priority);
+  }
+  prio_list.push_back(std::forward<T>(value));
+  nc = std::make_pair(priority, std::prev(prio_list.end()));
+}
+}  // namespace nyx::data_structure
+
+#endif  // !DATA_STRUCTURE_HIERARCHICAL_PRIORITY_QUEUE_HPP
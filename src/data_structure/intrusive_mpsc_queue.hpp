@@ -0,0 +1,102 @@
+#ifndef DATA_STRUCTURE_INTRUSIVE_MPSC_QUEUE_HPP
+#define DATA_STRUCTURE_INTRUSIVE_MPSC_QUEUE_HPP
+
+// Intrusive multi producer, single consumer queue (Dmitry Vyukov's non-intrusive MPSC queue, made intrusive).
+//
+// Elements carry their own link by deriving from MpscHook, so the queue never allocates and its memory is
+// bounded by the elements in flight. push is a single exchange followed by a store, wait-free for any number
+// of producers. pop is O(1) for the one consumer.
+// A producer that was preempted between its exchange and its store hides the elements pushed after it until
+// it resumes: pop then reports empty although the queue is not, and the consumer is expected to retry.
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+#include "src/common/include/define.hpp"
+
+namespace nyx::data_structure {
+
+using namespace common::define;
+
+// Base class of queued elements. An element can sit in one queue per Tag at a time.
+template <typename Tag = void>
+struct MpscHook {
+  std::atomic<MpscHook*> mpsc_next{nullptr};
+};
+
+template <typename T, typename Tag = void>
+class IntrusiveMpscQueue {
+  static_assert(std::is_base_of_v<MpscHook<Tag>, T>, "T must derive from MpscHook<Tag>");
+  using Hook = MpscHook<Tag>;
+
+  // Producers swap themselves in here
+  alignas(hardware_constructive_interference_size) std::atomic<Hook*> head_;
+  // Consumer only
+  alignas(hardware_constructive_interference_size) Hook* tail_;
+  // Keeps the list non-empty, so that producers never touch tail_
+  Hook stub_;
+
+  char padding_[kPaddingSize];
+
+ public:
+  IntrusiveMpscQueue() : head_(&stub_), tail_(&stub_) {}
+
+  IntrusiveMpscQueue(const IntrusiveMpscQueue&) = delete;
+  IntrusiveMpscQueue& operator=(const IntrusiveMpscQueue&) = delete;
+
+  // Any thread. The element must stay alive and unmodified until it is popped.
+  void push(T* element) noexcept { push_(static_cast<Hook*>(element)); }
+  // Consumer only. Returns nullptr when the queue is empty or a push is half way through.
+  T* pop() noexcept;
+  // Consumer only.
+  bool empty() const noexcept { return tail_->mpsc_next.load(std::memory_order_acquire) == nullptr && tail_ == head_.load(std::memory_order_acquire); }
+
+ private:
+  void push_(Hook*) noexcept;
+};
+
+template <typename T, typename Tag>
+void IntrusiveMpscQueue<T, Tag>::push_(Hook* hook) noexcept {
+  hook->mpsc_next.store(nullptr, std::memory_order_relaxed);
+  auto* prev = head_.exchange(hook, std::memory_order_acq_rel);
+  // Until this store the consumer cannot reach hook nor anything pushed after it
+  prev->mpsc_next.store(hook, std::memory_order_release);
+}
+
+template <typename T, typename Tag>
+T* IntrusiveMpscQueue<T, Tag>::pop() noexcept {
+  auto* tail = tail_;
+  auto* next = tail->mpsc_next.load(std::memory_order_acquire);
+
+  // Step over the stub, it is not an element
+  if (tail == &stub_) {
+    if (next == nullptr) {
+      return nullptr;
+    }
+    tail_ = tail = next;
+    next = next->mpsc_next.load(std::memory_order_acquire);
+  }
+
+  if (next != nullptr) {
+    tail_ = next;
+    return static_cast<T*>(tail);
+  }
+
+  // tail is the last linked element. Unless a producer already swapped head_, re-insert the stub behind
+  // it so that tail can be handed out without leaving the list empty.
+  if (tail != head_.load(std::memory_order_acquire)) {
+    return nullptr;
+  }
+  push_(&stub_);
+
+  next = tail->mpsc_next.load(std::memory_order_acquire);
+  if (next != nullptr) {
+    tail_ = next;
+    return static_cast<T*>(tail);
+  }
+  return nullptr;
+}
+}  // namespace nyx::data_structure
+
+#endif  // !DATA_STRUCTURE_INTRUSIVE_MPSC_QUEUE_HPP
@@ -4,11 +4,16 @@
 // re-implemented from the xenium for learning purpose.
 
 #include <atomic>
+#include <cassert>
 #include <cstddef>
 
 #include "src/utils/include/bitwise.hpp"
 
 namespace nyx::data_structure {
+// Circular array of atomic T* slots for Chase-Lev style deques. Only the owner writes and grows it,
+// any thread may read. Growing copies the live range into a ring twice as large; the old ring is
+// retired but stays readable until the array is destroyed, so a reader still holding it never
+// touches freed memory. Retired rings add up to less than the current ring.
 template <typename T, std::size_t MinCapacity = 64, std::size_t MaxCapacity = 1LL << 31>
 struct LockfreeGrowingCircularArray {
   // Validate arguments
@@ -17,18 +22,87 @@ struct LockfreeGrowingCircularArray {
   static_assert(MinCapacity <= MaxCapacity, "MinCapacity must be less than or equal MaxCapacity");
 
  private:
-  std::size_t size_;
+  struct Ring {
+    std::size_t mask;
+    std::atomic<T*>* slots;
+    Ring* retired;  // ring this one replaced
+
+    explicit Ring(std::size_t capacity, Ring* retired = nullptr)
+        : mask(capacity - 1), slots(new std::atomic<T*>[capacity]()), retired(retired) {}
+    ~Ring() { delete[] slots; }
+
+    std::atomic<T*>& slot(std::size_t index) const { return slots[index & mask]; }
+  };
+
   std::atomic<std::size_t> capacity_;
-  std::atomic<T*>* ring_;
+  std::atomic<Ring*> ring_;
 
  public:
   // Constructor & Destructor
-  LockfreeGrowingCircularArray();
+  explicit LockfreeGrowingCircularArray(std::size_t capacity = MinCapacity);
   ~LockfreeGrowingCircularArray();
 
+  LockfreeGrowingCircularArray(const LockfreeGrowingCircularArray&) = delete;
+  LockfreeGrowingCircularArray& operator=(const LockfreeGrowingCircularArray&) = delete;
+
   // Public methods
-  std::size_t capacity() { return capacity_.load(std::memory_order_relaxed); }
+  std::size_t capacity() const { return capacity_.load(std::memory_order_relaxed); }
+  bool can_grow() const { return capacity() < MaxCapacity; }
+
+  T* get(std::size_t index, std::memory_order order = std::memory_order_acquire) const;
+  void put(std::size_t index, T* value, std::memory_order order = std::memory_order_release);
+
+  // Owner only. Doubles the capacity and carries over the slots in [top, bottom).
+  void grow(std::size_t bottom, std::size_t top);
 };
+
+template <typename T, std::size_t MinCapacity, std::size_t MaxCapacity>
+LockfreeGrowingCircularArray<T, MinCapacity, MaxCapacity>::LockfreeGrowingCircularArray(std::size_t capacity) {
+  std::size_t rounded = MinCapacity;
+  while (rounded < capacity && rounded < MaxCapacity) {
+    rounded <<= 1;
+  }
+
+  capacity_.store(rounded, std::memory_order_relaxed);
+  ring_.store(new Ring(rounded), std::memory_order_relaxed);
+}
+
+template <typename T, std::size_t MinCapacity, std::size_t MaxCapacity>
+LockfreeGrowingCircularArray<T, MinCapacity, MaxCapacity>::~LockfreeGrowingCircularArray() {
+  Ring* ring = ring_.load(std::memory_order_relaxed);
+  while (ring != nullptr) {
+    Ring* retired = ring->retired;
+    delete ring;
+    ring = retired;
+  }
+}
+
+template <typename T, std::size_t MinCapacity, std::size_t MaxCapacity>
+T* LockfreeGrowingCircularArray<T, MinCapacity, MaxCapacity>::get(std::size_t index, std::memory_order order) const {
+  return ring_.load(std::memory_order_acquire)->slot(index).load(order);
+}
+
+template <typename T, std::size_t MinCapacity, std::size_t MaxCapacity>
+void LockfreeGrowingCircularArray<T, MinCapacity, MaxCapacity>::put(std::size_t index, T* value, std::memory_order order) {
+  ring_.load(std::memory_order_relaxed)->slot(index).store(value, order);
+}
+
+template <typename T, std::size_t MinCapacity, std::size_t MaxCapacity>
+void LockfreeGrowingCircularArray<T, MinCapacity, MaxCapacity>::grow(std::size_t bottom, std::size_t top) {
+  assert(can_grow());
+
+  Ring* old_ring = ring_.load(std::memory_order_relaxed);
+  auto new_capacity = (old_ring->mask + 1) << 1;
+  Ring* new_ring = new Ring(new_capacity, old_ring);
+
+  for (std::size_t i = top; i != bottom; ++i) {
+    new_ring->slot(i).store(old_ring->slot(i).load(std::memory_order_relaxed), std::memory_order_relaxed);
+  }
+
+  // Readers that load the new ring see the copied slots
+  ring_.store(new_ring, std::memory_order_release);
+  capacity_.store(new_capacity, std::memory_order_relaxed);
+}
 }  // namespace nyx::data_structure
 
 #endif  // !DATA_STRUCTURE_GROWING_CIRCULAR_ARRAY
@@ -0,0 +1,169 @@
+#ifndef DATA_STRUCTURE_MPMC_LOCKFREE_QUEUE_HPP
+#define DATA_STRUCTURE_MPMC_LOCKFREE_QUEUE_HPP
+
+// Bounded multi-producer/multi-consumer ring based on Dmitry Vyukov's design.
+// Every slot carries a sequence number that tells producers and consumers whether
+// the slot is ready for them, so the only contended words are the two cursors.
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "src/common/include/define.hpp"
+
+namespace nyx::data_structure {
+
+using namespace common::define;
+
+template <typename T, typename Alloc = std::allocator<T>>
+class MpmcLockFreeQueue : private Alloc {
+  struct Slot {
+    std::atomic<std::size_t> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T* element() { return reinterpret_cast<T*>(storage); }
+  };
+
+  using SlotAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Slot>;
+  using SlotAllocTraits = std::allocator_traits<SlotAlloc>;
+
+  std::size_t capacity_;
+  Slot* ring_;
+  static_assert(std::atomic<std::size_t>::is_always_lock_free);
+
+  // push cursor, shared by all producers
+  alignas(hardware_constructive_interference_size) std::atomic<std::size_t> push_cursor_{0};
+
+  // pop cursor, shared by all consumers
+  alignas(hardware_constructive_interference_size) std::atomic<std::size_t> pop_cursor_{0};
+
+  char padding_[kPaddingSize];
+
+ public:
+  explicit MpmcLockFreeQueue(std::size_t capacity, Alloc const& alloc = Alloc{});
+  ~MpmcLockFreeQueue();
+
+  MpmcLockFreeQueue(const MpmcLockFreeQueue&) = delete;
+  MpmcLockFreeQueue& operator=(const MpmcLockFreeQueue&) = delete;
+
+  std::size_t capacity() const { return capacity_; }
+
+  // Approximate when other threads are active.
+  std::size_t size() const;
+  bool empty() const { return size() == 0; }
+
+  bool push(T const&);
+  bool push(T&&);
+  bool pop(T&);
+
+ private:
+  Slot* slot(std::size_t cursor) const { return &ring_[cursor % capacity_]; }
+
+  template <typename U>
+  bool push_(U&&);
+};
+
+template <typename T, typename Alloc>
+MpmcLockFreeQueue<T, Alloc>::MpmcLockFreeQueue(std::size_t capacity, Alloc const& alloc) : Alloc{alloc}, capacity_{capacity} {
+  assert(capacity_ > 0);
+  SlotAlloc slot_alloc{*this};
+  ring_ = SlotAllocTraits::allocate(slot_alloc, capacity_);
+  for (std::size_t i = 0; i < capacity_; ++i) {
+    new (&ring_[i].sequence) std::atomic<std::size_t>{i};
+  }
+}
+
+template <typename T, typename Alloc>
+MpmcLockFreeQueue<T, Alloc>::~MpmcLockFreeQueue() {
+  std::size_t push_cursor = push_cursor_.load(std::memory_order_relaxed);
+  for (std::size_t cursor = pop_cursor_.load(std::memory_order_relaxed); cursor != push_cursor; ++cursor) {
+    slot(cursor)->element()->~T();
+  }
+
+  SlotAlloc slot_alloc{*this};
+  SlotAllocTraits::deallocate(slot_alloc, ring_, capacity_);
+}
+
+template <typename T, typename Alloc>
+std::size_t MpmcLockFreeQueue<T, Alloc>::size() const {
+  std::size_t pop_cursor = pop_cursor_.load(std::memory_order_acquire);
+  std::size_t push_cursor = push_cursor_.load(std::memory_order_acquire);
+  return push_cursor > pop_cursor ? push_cursor - pop_cursor : 0;
+}
+
+template <typename T, typename Alloc>
+bool MpmcLockFreeQueue<T, Alloc>::push(T const& value) {
+  return push_(value);
+}
+
+template <typename T, typename Alloc>
+bool MpmcLockFreeQueue<T, Alloc>::push(T&& value) {
+  return push_(std::move(value));
+}
+
+template <typename T, typename Alloc>
+template <typename U>
+bool MpmcLockFreeQueue<T, Alloc>::push_(U&& value) {
+  auto push_cursor = push_cursor_.load(std::memory_order_relaxed);
+  Slot* s;
+
+  for (;;) {
+    s = slot(push_cursor);
+    auto sequence = s->sequence.load(std::memory_order_acquire);
+    auto diff = static_cast<std::ptrdiff_t>(sequence - push_cursor);
+
+    if (diff == 0) {
+      // Slot is free for this lap, try to claim it
+      if (push_cursor_.compare_exchange_weak(push_cursor, push_cursor + 1, std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      // Slot still holds the element from the previous lap, queue is full
+      return false;
+    } else {
+      // Another producer claimed this cursor, catch up
+      push_cursor = push_cursor_.load(std::memory_order_relaxed);
+    }
+  }
+
+  new (s->element()) T(std::forward<U>(value));
+  s->sequence.store(push_cursor + 1, std::memory_order_release);
+
+  return true;
+}
+
+template <typename T, typename Alloc>
+bool MpmcLockFreeQueue<T, Alloc>::pop(T& value) {
+  auto pop_cursor = pop_cursor_.load(std::memory_order_relaxed);
+  Slot* s;
+
+  for (;;) {
+    s = slot(pop_cursor);
+    auto sequence = s->sequence.load(std::memory_order_acquire);
+    auto diff = static_cast<std::ptrdiff_t>(sequence - (pop_cursor + 1));
+
+    if (diff == 0) {
+      // Slot is published for this lap, try to claim it
+      if (pop_cursor_.compare_exchange_weak(pop_cursor, pop_cursor + 1, std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      // Producer has not published this slot yet, queue is empty
+      return false;
+    } else {
+      // Another consumer claimed this cursor, catch up
+      pop_cursor = pop_cursor_.load(std::memory_order_relaxed);
+    }
+  }
+
+  value = std::move(*s->element());
+  s->element()->~T();
+  s->sequence.store(pop_cursor + capacity_, std::memory_order_release);
+
+  return true;
+}
+}  // namespace nyx::data_structure
+
+#endif  // !DATA_STRUCTURE_MPMC_LOCKFREE_QUEUE_HPP
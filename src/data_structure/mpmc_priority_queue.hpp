@@ -0,0 +1,135 @@
+#ifndef DATA_STRUCTURE_MPMC_PRIORITY_QUEUE_HPP
+#define DATA_STRUCTURE_MPMC_PRIORITY_QUEUE_HPP
+
+// Concurrent counterpart of priority_queue: a fixed number of priority levels, each one a bounded
+// MpmcLockFreeQueue, plus a marker word with one bit per level that may be non-empty.
+//
+// The marker is only a hint. Producers set the bit after publishing into the level, consumers clear it
+// when they find the level empty and put it back if an element slipped in meanwhile, so an element is
+// never stranded behind a cleared bit. Elements of the same level pop in FIFO order.
+
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "src/common/include/define.hpp"
+#include "src/data_structure/mpmc_lockfree_queue.hpp"
+
+namespace nyx::data_structure {
+
+using namespace common::define;
+
+template <typename T, std::size_t Levels = sizeof_size_t>
+class MpmcPriorityQueue {
+  static_assert(Levels > 0 && Levels <= sizeof_size_t, "marker_ holds one bit per level");
+
+  alignas(hardware_constructive_interference_size) std::atomic<std::size_t> marker_{0};
+  std::vector<std::unique_ptr<MpmcLockFreeQueue<T>>> levels_;
+
+  char padding_[kPaddingSize];
+
+ public:
+  // Every level can hold level_capacity elements.
+  explicit MpmcPriorityQueue(std::size_t level_capacity);
+
+  MpmcPriorityQueue(const MpmcPriorityQueue&) = delete;
+  MpmcPriorityQueue& operator=(const MpmcPriorityQueue&) = delete;
+
+  static constexpr std::size_t levels() noexcept { return Levels; }
+  std::size_t level_capacity() const noexcept { return levels_.front()->capacity(); }
+
+  // Approximate when other threads are active.
+  std::size_t size() const noexcept;
+  // Not read from marker_: a bit stays set after the last pop of its level until a pop finds the level empty.
+  bool empty() const noexcept { return size() == 0; }
+
+  // Returns false when the level of priority is full.
+  bool push(T const&, const std::uint8_t& priority);
+  bool push(T&&, const std::uint8_t& priority);
+  // Pops from the highest non-empty level. May miss elements whose push has not returned yet.
+  bool try_pop(T&);
+
+ private:
+  static std::size_t bit_(std::size_t priority) noexcept { return std::size_t{1} << priority; }
+
+  template <typename U>
+  bool push_(U&&, const std::uint8_t&);
+};
+
+template <typename T, std::size_t Levels>
+MpmcPriorityQueue<T, Levels>::MpmcPriorityQueue(std::size_t level_capacity) {
+  levels_.reserve(Levels);
+  for (std::size_t i = 0; i < Levels; ++i) {
+    levels_.push_back(std::make_unique<MpmcLockFreeQueue<T>>(level_capacity));
+  }
+}
+
+template <typename T, std::size_t Levels>
+std::size_t MpmcPriorityQueue<T, Levels>::size() const noexcept {
+  std::size_t size = 0;
+  for (const auto& level : levels_) {
+    size += level->size();
+  }
+  return size;
+}
+
+template <typename T, std::size_t Levels>
+bool MpmcPriorityQueue<T, Levels>::push(T const& value, const std::uint8_t& priority) {
+  return push_(value, priority);
+}
+
+template <typename T, std::size_t Levels>
+bool MpmcPriorityQueue<T, Levels>::push(T&& value, const std::uint8_t& priority) {
+  return push_(std::move(value), priority);
+}
+
+template <typename T, std::size_t Levels>
+template <typename U>
+bool MpmcPriorityQueue<T, Levels>::push_(U&& value, const std::uint8_t& priority) {
+  assert(priority < Levels);
+  if (!levels_[priority]->push(std::forward<U>(value))) {
+    return false;
+  }
+
+  // Pairs with the fence in try_pop(): either we see the bit cleared and set it again, or the consumer
+  // that cleared it sees our element. Skipping the RMW keeps the marker line shared while the bit is set.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if ((marker_.load(std::memory_order_relaxed) & bit_(priority)) == 0) {
+    marker_.fetch_or(bit_(priority), std::memory_order_release);
+  }
+
+  return true;
+}
+
+template <typename T, std::size_t Levels>
+bool MpmcPriorityQueue<T, Levels>::try_pop(T& value) {
+  auto marker = marker_.load(std::memory_order_acquire);
+
+  // Walk a snapshot from the highest level down, so one call is bounded even while producers race with us
+  while (marker != 0) {
+    std::size_t priority = sizeof_size_t - 1 - std::countl_zero(marker);
+    marker &= ~bit_(priority);
+
+    auto& level = levels_[priority];
+    if (level->pop(value)) {
+      return true;
+    }
+
+    // Level looks empty. Its last element may still be in flight, then the producer or we restore the bit.
+    marker_.fetch_and(~bit_(priority), std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!level->empty()) {
+      marker_.fetch_or(bit_(priority), std::memory_order_release);
+    }
+  }
+
+  return false;
+}
+}  // namespace nyx::data_structure
+
+#endif  // !DATA_STRUCTURE_MPMC_PRIORITY_QUEUE_HPP
@@ -0,0 +1,261 @@
+#ifndef DATA_STRUCTURE_MULTICAST_RING_HPP
+#define DATA_STRUCTURE_MULTICAST_RING_HPP
+
+// Single producer, multi consumer ring in the style of the LMAX disruptor: every consumer sees every event.
+//
+// Slots are allocated once and reused, the producer fills them in place and publishes them by advancing its
+// cursor. Each consumer owns a sequence, the number of events it released, and reads the slots between its
+// sequence and its barrier: the producer cursor, or the slowest sequence of the consumers it depends on. A
+// consumer that depends on others forms a later pipeline stage and may read what the earlier stages wrote
+// into the event. The producer never overwrites a slot before every consumer released it, it only has to
+// look at the last stages since earlier stages are always ahead of the stages that depend on them.
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "src/common/include/define.hpp"
+#include "src/data_structure/blocking_scsp_queue.hpp"
+
+namespace nyx::data_structure {
+
+using namespace common::define;
+
+// T must be default constructible, slots are constructed up front. WaitStrategy is one of wait_strategy.
+template <typename T, typename WaitStrategy = wait_strategy::SpinThenYield<>>
+class MulticastRing {
+ public:
+  class Consumer {
+    friend class MulticastRing;
+
+    MulticastRing* ring_;
+    std::vector<const Consumer*> dependencies_;
+
+    // Events below sequence_ are released, written by this consumer only
+    alignas(hardware_constructive_interference_size) std::atomic<std::size_t> sequence_{0};
+    mutable WaitStrategy released_;
+    alignas(hardware_constructive_interference_size) std::size_t cached_barrier_{0};
+
+    char padding_[kPaddingSize];
+
+    Consumer(MulticastRing* ring, std::initializer_list<const Consumer*> dependencies) : ring_(ring), dependencies_(dependencies) {}
+
+    // Slowest word this consumer reads behind, together with the owner that signals it
+    std::pair<const std::atomic<std::size_t>*, WaitStrategy*> barrier_word_() const;
+
+   public:
+    Consumer(const Consumer&) = delete;
+    Consumer& operator=(const Consumer&) = delete;
+
+    // Next sequence to read.
+    std::size_t sequence() const noexcept { return sequence_.load(std::memory_order_relaxed); }
+
+    // Number of events ready for this consumer.
+    std::size_t available();
+    // Blocks until at least one event is ready, returns their number.
+    std::size_t wait();
+
+    // Calls handler(T&, sequence) on up to max ready events and releases them with a single store.
+    // Returns the number of events handled.
+    template <typename Handler>
+    std::size_t poll(Handler&& handler, std::size_t max = SIZE_MAX);
+  };
+
+ private:
+  std::size_t mask_;
+  std::unique_ptr<T[]> slots_;
+  std::vector<std::unique_ptr<Consumer>> consumers_;
+  // Consumers no other consumer depends on, the producer waits for them
+  std::vector<Consumer*> gating_;
+
+  // Events below cursor_ are published
+  alignas(hardware_constructive_interference_size) std::atomic<std::size_t> cursor_{0};
+  WaitStrategy published_;
+  // Producer only
+  alignas(hardware_constructive_interference_size) std::size_t cached_gate_{0};
+  std::size_t claimed_{0};
+
+  char padding_[kPaddingSize];
+
+ public:
+  // capacity must be a power of two.
+  explicit MulticastRing(std::size_t capacity);
+
+  MulticastRing(const MulticastRing&) = delete;
+  MulticastRing& operator=(const MulticastRing&) = delete;
+
+  // Adds a consumer that reads every event once all of dependencies released it. Consumers must be added
+  // before the first event is published.
+  Consumer& add_consumer(std::initializer_list<const Consumer*> dependencies = {});
+
+  std::size_t capacity() const noexcept { return mask_ + 1; }
+  // Sequences below cursor() are published.
+  std::size_t cursor() const noexcept { return cursor_.load(std::memory_order_relaxed); }
+
+  T& operator[](std::size_t sequence) noexcept { return slots_[sequence & mask_]; }
+
+  // Producer side: claims up to max slots from cursor() on and returns how many were granted, then the
+  // caller fills them through operator[] and makes them visible with publish().
+  std::size_t try_claim(std::size_t max = 1);
+  // Same as try_claim but blocks until at least one slot is free.
+  std::size_t claim(std::size_t max = 1);
+  // Publishes the first count claimed slots.
+  void publish(std::size_t count = 1);
+
+  // Claims one slot, calls fill(T&) on it and publishes it. Returns false when the ring is full.
+  template <typename Fill>
+  bool try_publish(Fill&& fill);
+
+ private:
+  // Slowest gating consumer, or nullptr when there are none
+  Consumer* slowest_() const noexcept;
+};
+
+template <typename T, typename WaitStrategy>
+MulticastRing<T, WaitStrategy>::MulticastRing(std::size_t capacity) : mask_(capacity - 1), slots_(std::make_unique<T[]>(capacity)) {
+  assert(capacity > 0 && (capacity & (capacity - 1)) == 0);
+}
+
+template <typename T, typename WaitStrategy>
+typename MulticastRing<T, WaitStrategy>::Consumer& MulticastRing<T, WaitStrategy>::add_consumer(
+    std::initializer_list<const Consumer*> dependencies) {
+  assert(cursor_.load(std::memory_order_relaxed) == 0);
+  auto& consumer = *consumers_.emplace_back(new Consumer(this, dependencies));
+
+  // Stages that others depend on no longer gate the producer
+  for (const auto* dependency : dependencies) {
+    assert(dependency->ring_ == this);
+    gating_.erase(std::remove(gating_.begin(), gating_.end(), dependency), gating_.end());
+  }
+  gating_.push_back(&consumer);
+
+  return consumer;
+}
+
+template <typename T, typename WaitStrategy>
+std::size_t MulticastRing<T, WaitStrategy>::try_claim(std::size_t max) {
+  auto cursor = cursor_.load(std::memory_order_relaxed);
+  auto free = capacity() - (cursor - cached_gate_);
+  if (free < max) {
+    auto* slowest = slowest_();
+    cached_gate_ = slowest == nullptr ? cursor : slowest->sequence_.load(std::memory_order_acquire);
+    free = capacity() - (cursor - cached_gate_);
+  }
+
+  claimed_ = std::min(free, max);
+  return claimed_;
+}
+
+template <typename T, typename WaitStrategy>
+std::size_t MulticastRing<T, WaitStrategy>::claim(std::size_t max) {
+  while (true) {
+    if (auto count = try_claim(max); count > 0) {
+      return count;
+    }
+
+    // Full means the slowest consumer is exactly one lap behind
+    auto* slowest = slowest_();
+    slowest->released_.wait(slowest->sequence_, cursor_.load(std::memory_order_relaxed) - capacity());
+  }
+}
+
+template <typename T, typename WaitStrategy>
+void MulticastRing<T, WaitStrategy>::publish(std::size_t count) {
+  assert(count <= claimed_);
+  claimed_ -= count;
+  cursor_.store(cursor_.load(std::memory_order_relaxed) + count, std::memory_order_release);
+  published_.notify(cursor_);
+}
+
+template <typename T, typename WaitStrategy>
+template <typename Fill>
+bool MulticastRing<T, WaitStrategy>::try_publish(Fill&& fill) {
+  if (try_claim(1) == 0) {
+    return false;
+  }
+
+  std::forward<Fill>(fill)((*this)[cursor_.load(std::memory_order_relaxed)]);
+  publish(1);
+  return true;
+}
+
+template <typename T, typename WaitStrategy>
+typename MulticastRing<T, WaitStrategy>::Consumer* MulticastRing<T, WaitStrategy>::slowest_() const noexcept {
+  Consumer* slowest = nullptr;
+  std::size_t lowest = SIZE_MAX;
+  for (auto* consumer : gating_) {
+    auto sequence = consumer->sequence_.load(std::memory_order_acquire);
+    if (sequence < lowest) {
+      lowest = sequence;
+      slowest = consumer;
+    }
+  }
+  return slowest;
+}
+
+template <typename T, typename WaitStrategy>
+std::pair<const std::atomic<std::size_t>*, WaitStrategy*> MulticastRing<T, WaitStrategy>::Consumer::barrier_word_() const {
+  // Dependencies never run ahead of the cursor, so they bound us whenever there are any
+  if (dependencies_.empty()) {
+    return {&ring_->cursor_, &ring_->published_};
+  }
+
+  auto* slowest = dependencies_.front();
+  auto lowest = slowest->sequence_.load(std::memory_order_acquire);
+  for (const auto* dependency : dependencies_) {
+    auto sequence = dependency->sequence_.load(std::memory_order_acquire);
+    if (sequence < lowest) {
+      lowest = sequence;
+      slowest = dependency;
+    }
+  }
+  return {&slowest->sequence_, &slowest->released_};
+}
+
+template <typename T, typename WaitStrategy>
+std::size_t MulticastRing<T, WaitStrategy>::Consumer::available() {
+  auto sequence = sequence_.load(std::memory_order_relaxed);
+  if (cached_barrier_ == sequence) {
+    cached_barrier_ = barrier_word_().first->load(std::memory_order_acquire);
+  }
+  return cached_barrier_ - sequence;
+}
+
+template <typename T, typename WaitStrategy>
+std::size_t MulticastRing<T, WaitStrategy>::Consumer::wait() {
+  auto sequence = sequence_.load(std::memory_order_relaxed);
+  while (true) {
+    if (auto count = available(); count > 0) {
+      return count;
+    }
+    auto [word, strategy] = barrier_word_();
+    strategy->wait(*word, sequence);
+  }
+}
+
+template <typename T, typename WaitStrategy>
+template <typename Handler>
+std::size_t MulticastRing<T, WaitStrategy>::Consumer::poll(Handler&& handler, std::size_t max) {
+  auto count = std::min(available(), max);
+  if (count == 0) {
+    return 0;
+  }
+
+  auto sequence = sequence_.load(std::memory_order_relaxed);
+  for (std::size_t i = 0; i < count; ++i) {
+    handler((*ring_)[sequence + i], sequence + i);
+  }
+  sequence_.store(sequence + count, std::memory_order_release);
+  released_.notify(sequence_);
+
+  return count;
+}
+}  // namespace nyx::data_structure
+
+#endif  // !DATA_STRUCTURE_MULTICAST_RING_HPP
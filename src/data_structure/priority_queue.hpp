@@ -16,12 +16,13 @@
 #include "src/utils/include/bitwise.hpp"
 
 namespace nyx::data_structure {
-template <typename T>
+// Map is the container from element to its node, FlatHashMap is a drop-in replacement for the default.
+template <typename T, template <typename...> class Map = std::unordered_map>
 class priority_queue {
  public:
   typedef typename std::list<T>::iterator node_addr_t;
   typedef std::pair<uint8_t, node_addr_t> node_container_t;
-  typedef typename std::unordered_map<T, node_container_t> addr_map_t;
+  typedef Map<T, node_container_t> addr_map_t;
   typedef typename addr_map_t::iterator addr_map_it_t;
 
  private:
@@ -53,14 +54,14 @@ class priority_queue {
   void push_and_update_internal_(T&&, const uint8_t&, addr_map_it_t&) noexcept;
 };
 
-template <typename T>
-bool priority_queue<T>::is_exsit(const T& value) const noexcept {
+template <typename T, template <typename...> class Map>
+bool priority_queue<T, Map>::is_exsit(const T& value) const noexcept {
   auto it = addr_map_.find(value);
   return it != addr_map_.end() && it->second != empty_node_;
 }
 
-template <typename T>
-void priority_queue<T>::push_no_update(T&& value, const uint8_t& priority) noexcept {
+template <typename T, template <typename...> class Map>
+void priority_queue<T, Map>::push_no_update(T&& value, const uint8_t& priority) noexcept {
   assert(priority < common::define::sizeof_size_t);
   auto it = addr_map_.find(value);
   if (it != addr_map_.end() && it->second != empty_node_) {
@@ -69,15 +70,15 @@ void priority_queue<T>::push_no_update(T&& value, const uint8_t& priority) noexc
   push_and_update_internal_(std::forward<T>(value), priority, it);
 }
 
-template <typename T>
-void priority_queue<T>::push_and_update(T&& value, const uint8_t& priority) noexcept {
+template <typename T, template <typename...> class Map>
+void priority_queue<T, Map>::push_and_update(T&& value, const uint8_t& priority) noexcept {
   assert(priority < common::define::sizeof_size_t);
   auto it = addr_map_it_t();
   push_and_update_internal_(std::forward<T>(value), priority, it);
 }
 
-template <typename T>
-void priority_queue<T>::push_and_update_internal_(T&& value, const uint8_t& priority, addr_map_it_t& it) noexcept {
+template <typename T, template <typename...> class Map>
+void priority_queue<T, Map>::push_and_update_internal_(T&& value, const uint8_t& priority, addr_map_it_t& it) noexcept {
   if (it == addr_map_it_t()) {
     it = addr_map_.find(value);
   }
@@ -113,19 +114,18 @@ void priority_queue<T>::push_and_update_internal_(T&& value, const uint8_t& prio
   addr_map_[prio_list.back()] = std::make_pair(priority, std::prev(prio_list.end()));
 }
 
-template <typename T>
-bool priority_queue<T>::try_pop(T& out) noexcept {
+template <typename T, template <typename...> class Map>
+bool priority_queue<T, Map>::try_pop(T& out) noexcept {
   if (marker_ == 0) {
     return false;
   }
 
-  const int8_t higest_priority = 0;
-  // const int8_t higest_priority = utils::bitwise::lmb(marker_);
+  const int8_t higest_priority = utils::bitwise::lmb(marker_);
   auto& prio_list = priorities_[higest_priority];
   out = prio_list.front();
   prio_list.pop_front();
 
-  // addr_map_[out] = empty_node_;
+  addr_map_.erase(out);
 
   if (prio_list.empty()) {
     utils::bitwise::turn_off_bit(marker_, higest_priority);
@@ -134,8 +134,8 @@ bool priority_queue<T>::try_pop(T& out) noexcept {
   return true;
 }
 
-template <typename T>
-void priority_queue<T>::remove(const T& value) noexcept {
+template <typename T, template <typename...> class Map>
+void priority_queue<T, Map>::remove(const T& value) noexcept {
   auto it = addr_map_.find(value);
   if (it == addr_map_.end() || it->second == empty_node_) {
     return;
@@ -153,8 +153,8 @@ void priority_queue<T>::remove(const T& value) noexcept {
   addr_map_[it->first] = empty_node_;
 }
 
-template <typename T>
-std::optional<uint8_t> priority_queue<T>::get_priority(const T& value) const noexcept {
+template <typename T, template <typename...> class Map>
+std::optional<uint8_t> priority_queue<T, Map>::get_priority(const T& value) const noexcept {
   auto it = addr_map_.find(value);
   if (it == addr_map_.end() || it->second == empty_node_) {
     return std::nullopt;
@@ -163,8 +163,8 @@ std::optional<uint8_t> priority_queue<T>::get_priority(const T& value) const noe
   return it->second.first;
 }
 
-template <typename T>
-void priority_queue<T>::clear() noexcept {
+template <typename T, template <typename...> class Map>
+void priority_queue<T, Map>::clear() noexcept {
   addr_map_.clear();
   for (auto& it : priorities_) {
     it.clear();
@@ -172,8 +172,8 @@ void priority_queue<T>::clear() noexcept {
   marker_ = 0;
 }
 
-template <typename T>
-size_t priority_queue<T>::size() const noexcept {
+template <typename T, template <typename...> class Map>
+size_t priority_queue<T, Map>::size() const noexcept {
   return addr_map_.size();
 }
 }  // namespace nyx::data_structure
@@ -4,7 +4,10 @@
 #include <atomic>
 #include <cassert>
 #include <cstddef>
+#include <iterator>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 #include "src/common/include/define.hpp"
 
@@ -12,7 +15,11 @@ namespace nyx::data_structure {
 
 using namespace common::define;
 
-template <typename T, typename Alloc = std::allocator<T>>
+template <typename T, typename WaitStrategy, typename Alloc>
+class BlockingScspQueue;
+
+// With PowerOfTwo set, capacity must be a power of two and slots are addressed with a mask instead of a modulo.
+template <typename T, typename Alloc = std::allocator<T>, bool PowerOfTwo = false>
 class ScspLockFreeQueue : private Alloc {
   std::size_t capacity_;
   T* ring_;
@@ -28,9 +35,15 @@ class ScspLockFreeQueue : private Alloc {
 
   char padding_[kPaddingSize];
 
+  // Waits on the cursor words directly
+  template <typename, typename, typename>
+  friend class BlockingScspQueue;
+
  public:
   ScspLockFreeQueue(size_t capacity, Alloc const& alloc = Alloc{})
-      : Alloc{alloc}, capacity_{capacity}, ring_{std::allocator_traits<Alloc>::allocate(*this, capacity)} {}
+      : Alloc{alloc}, capacity_{capacity}, ring_{std::allocator_traits<Alloc>::allocate(*this, capacity)} {
+    assert(!PowerOfTwo || (capacity_ > 0 && (capacity_ & (capacity_ - 1)) == 0));
+  }
 
   explicit ScspLockFreeQueue(ScspLockFreeQueue&& other) {
     if (this != &other) {
@@ -65,28 +78,58 @@ class ScspLockFreeQueue : private Alloc {
     return empty_(cached_push_cursor_, cached_pop_cursor_);
   }
 
-  auto element(std::size_t cursor) { return &ring_[cursor % capacity_]; }
+  auto element(std::size_t cursor) {
+    if constexpr (PowerOfTwo) {
+      return &ring_[cursor & (capacity_ - 1)];
+    } else {
+      return &ring_[cursor % capacity_];
+    }
+  }
 
   bool push(T const&);
   bool pop(T&);
   bool push(T&&);
 
+  // Construct an element directly in the next free slot.
+  template <typename... Args>
+  bool try_emplace(Args&&...);
+
+  // Producer side zero-copy API: reserve() returns the raw storage of the next free slot (nullptr when full),
+  // the caller constructs a T in it and publishes it with commit().
+  T* reserve();
+  void commit();
+
+  // Consumer side zero-copy API: front() returns the oldest element (nullptr when empty),
+  // consume() destroys it and releases the slot to the producer.
+  T* front();
+  void consume();
+
+  // Push as many elements of [first, last) as fit, publishing them with a single cursor store.
+  // Returns the number of elements pushed. Wrap first/last in std::move_iterator to move them in.
+  template <typename InputIt>
+  std::size_t push_bulk(InputIt first, InputIt last);
+
+  // Pop up to max elements into out, releasing their slots with a single cursor store.
+  // Returns the number of elements popped.
+  template <typename OutputIt>
+  std::size_t pop_bulk(OutputIt out, std::size_t max);
+
  public:
-  void operator=(ScspLockFreeQueue<T, Alloc>&& other);
+  void operator=(ScspLockFreeQueue<T, Alloc, PowerOfTwo>&& other);
 
  private:
   bool empty_(std::size_t push_cursor, std::size_t pop_cursor) const { return push_cursor == pop_cursor; }
   void free_up_() {
     while (!empty_(push_cursor_, pop_cursor_)) {
-      ring_[pop_cursor_.load(std::memory_order_relaxed) % capacity_].~T();
+      element(pop_cursor_.load(std::memory_order_relaxed))->~T();
       pop_cursor_.fetch_add(1, std::memory_order_relaxed);
     }
     std::allocator_traits<Alloc>::deallocate(*this, ring_, capacity_);
   }
 };
 
-template <typename T, typename Alloc>
-bool ScspLockFreeQueue<T, Alloc>::push(T const& value) {
+template <typename T, typename Alloc, bool PowerOfTwo>
+bool ScspLockFreeQueue<T, Alloc, PowerOfTwo>::push(T const& value) {
   auto push_cursor = push_cursor_.load(std::memory_order_relaxed);
   if (full(push_cursor, cached_pop_cursor_)) {
     cached_pop_cursor_ = pop_cursor_.load(std::memory_order_acquire);
@@ -101,8 +144,8 @@ bool ScspLockFreeQueue<T, Alloc>::push(T const& value) {
   return true;
 }
 
-template <typename T, typename Alloc>
-bool ScspLockFreeQueue<T, Alloc>::push(T&& value) {
+template <typename T, typename Alloc, bool PowerOfTwo>
+bool ScspLockFreeQueue<T, Alloc, PowerOfTwo>::push(T&& value) {
   auto push_cursor = push_cursor_.load(std::memory_order_relaxed);
   if (full(push_cursor, cached_pop_cursor_)) {
     cached_pop_cursor_ = pop_cursor_.load(std::memory_order_acquire);
@@ -117,8 +160,8 @@ bool ScspLockFreeQueue<T, Alloc>::push(T&& value) {
   return true;
 }
 
-template <typename T, typename Alloc>
-bool ScspLockFreeQueue<T, Alloc>::pop(T& value) {
+template <typename T, typename Alloc, bool PowerOfTwo>
+bool ScspLockFreeQueue<T, Alloc, PowerOfTwo>::pop(T& value) {
   auto pop_cursor = pop_cursor_.load(std::memory_order_relaxed);
   if (empty_(cached_push_cursor_, pop_cursor)) {
     cached_push_cursor_ = push_cursor_.load(std::memory_order_acquire);
@@ -134,8 +177,116 @@ bool ScspLockFreeQueue<T, Alloc>::pop(T& value) {
   return true;
 }
 
-template <typename T, typename Alloc>
-void ScspLockFreeQueue<T, Alloc>::operator=(ScspLockFreeQueue<T, Alloc>&& other) {
+template <typename T, typename Alloc, bool PowerOfTwo>
+template <typename... Args>
+bool ScspLockFreeQueue<T, Alloc, PowerOfTwo>::try_emplace(Args&&... args) {
+  auto slot = reserve();
+  if (slot == nullptr) {
+    return false;
+  }
+
+  new (slot) T(std::forward<Args>(args)...);
+  commit();
+
+  return true;
+}
+
+template <typename T, typename Alloc, bool PowerOfTwo>
+T* ScspLockFreeQueue<T, Alloc, PowerOfTwo>::reserve() {
+  auto push_cursor = push_cursor_.load(std::memory_order_relaxed);
+  if (full(push_cursor, cached_pop_cursor_)) {
+    cached_pop_cursor_ = pop_cursor_.load(std::memory_order_acquire);
+    if (full(push_cursor, cached_pop_cursor_)) {
+      return nullptr;
+    }
+  }
+
+  return element(push_cursor);
+}
+
+template <typename T, typename Alloc, bool PowerOfTwo>
+void ScspLockFreeQueue<T, Alloc, PowerOfTwo>::commit() {
+  auto push_cursor = push_cursor_.load(std::memory_order_relaxed);
+  assert(!full(push_cursor, cached_pop_cursor_));
+  push_cursor_.store(push_cursor + 1, std::memory_order_release);
+}
+
+template <typename T, typename Alloc, bool PowerOfTwo>
+T* ScspLockFreeQueue<T, Alloc, PowerOfTwo>::front() {
+  auto pop_cursor = pop_cursor_.load(std::memory_order_relaxed);
+  if (empty_(cached_push_cursor_, pop_cursor)) {
+    cached_push_cursor_ = push_cursor_.load(std::memory_order_acquire);
+    if (empty_(cached_push_cursor_, pop_cursor)) {
+      return nullptr;
+    }
+  }
+
+  return element(pop_cursor);
+}
+
+template <typename T, typename Alloc, bool PowerOfTwo>
+void ScspLockFreeQueue<T, Alloc, PowerOfTwo>::consume() {
+  auto pop_cursor = pop_cursor_.load(std::memory_order_relaxed);
+  assert(!empty_(cached_push_cursor_, pop_cursor));
+  element(pop_cursor)->~T();
+  pop_cursor_.store(pop_cursor + 1, std::memory_order_release);
+}
+
+template <typename T, typename Alloc, bool PowerOfTwo>
+template <typename InputIt>
+std::size_t ScspLockFreeQueue<T, Alloc, PowerOfTwo>::push_bulk(InputIt first, InputIt last) {
+  auto push_cursor = push_cursor_.load(std::memory_order_relaxed);
+
+  std::size_t wanted = capacity_;
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>) {
+    wanted = static_cast<std::size_t>(std::distance(first, last));
+  }
+
+  auto free = capacity_ - (push_cursor - cached_pop_cursor_);
+  if (free < wanted) {
+    cached_pop_cursor_ = pop_cursor_.load(std::memory_order_acquire);
+    free = capacity_ - (push_cursor - cached_pop_cursor_);
+  }
+
+  std::size_t count = 0;
+  for (; count < free && first != last; ++count, ++first) {
+    new (element(push_cursor + count)) T(*first);
+  }
+
+  if (count > 0) {
+    push_cursor_.store(push_cursor + count, std::memory_order_release);
+  }
+
+  return count;
+}
+
+template <typename T, typename Alloc, bool PowerOfTwo>
+template <typename OutputIt>
+std::size_t ScspLockFreeQueue<T, Alloc, PowerOfTwo>::pop_bulk(OutputIt out, std::size_t max) {
+  auto pop_cursor = pop_cursor_.load(std::memory_order_relaxed);
+
+  auto available = cached_push_cursor_ - pop_cursor;
+  if (available < max) {
+    cached_push_cursor_ = push_cursor_.load(std::memory_order_acquire);
+    available = cached_push_cursor_ - pop_cursor;
+  }
+
+  auto count = available < max ? available : max;
+  for (std::size_t i = 0; i < count; ++i, ++out) {
+    auto ptr = element(pop_cursor + i);
+    *out = std::move(*ptr);
+    ptr->~T();
+  }
+
+  if (count > 0) {
+    pop_cursor_.store(pop_cursor + count, std::memory_order_release);
+  }
+
+  return count;
+}
+
+template <typename T, typename Alloc, bool PowerOfTwo>
+void ScspLockFreeQueue<T, Alloc, PowerOfTwo>::operator=(ScspLockFreeQueue<T, Alloc, PowerOfTwo>&& other) {
   if (this != &other) {
     free_up_();
 
@@ -67,7 +67,6 @@ bool ScspMutexQueue<T, Alloc>::pop_front(T* value) {
 
   assert(push_cursor_ >= pop_cursor_);
   *value = ring_[pop_cursor_ % capacity_];
-  assert(*value < 0);
   ring_[pop_cursor_ % capacity_].~T();
   ++pop_cursor_;
 
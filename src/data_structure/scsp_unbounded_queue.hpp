@@ -0,0 +1,179 @@
+#ifndef DATA_STRUCTURE_SCSP_UNBOUNDED_QUEUE_HPP
+#define DATA_STRUCTURE_SCSP_UNBOUNDED_QUEUE_HPP
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "src/common/include/define.hpp"
+#include "src/data_structure/scsp_lockfree_queue.hpp"
+
+namespace nyx::data_structure {
+
+using namespace common::define;
+
+// Unbounded single-producer/single-consumer queue made of fixed-size segments.
+// Drained segments go back to the producer through a small ScspLockFreeQueue used as freelist,
+// so the queue only allocates while it grows past the memory it already owns.
+template <typename T, std::size_t SegmentSize = 512, typename Alloc = std::allocator<T>>
+class ScspUnboundedQueue : private Alloc {
+  static_assert(SegmentSize > 0);
+
+  struct alignas(hardware_constructive_interference_size) Segment {
+    Segment* next{nullptr};
+    alignas(T) unsigned char storage[SegmentSize * sizeof(T)];
+
+    T* element(std::size_t index) { return reinterpret_cast<T*>(storage) + index; }
+  };
+
+  using SegmentAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Segment>;
+  using SegmentAllocTraits = std::allocator_traits<SegmentAlloc>;
+  static_assert(std::atomic<std::size_t>::is_always_lock_free);
+
+  ScspLockFreeQueue<Segment*> freelist_;
+
+  // producer side
+  alignas(hardware_constructive_interference_size) std::atomic<std::size_t> push_cursor_{0};
+  Segment* tail_;
+
+  // consumer side
+  alignas(hardware_constructive_interference_size) std::atomic<std::size_t> pop_cursor_{0};
+  alignas(hardware_constructive_interference_size) std::size_t cached_push_cursor_{0};
+  Segment* head_;
+
+  char padding_[kPaddingSize];
+
+ public:
+  explicit ScspUnboundedQueue(std::size_t freelist_capacity = 8, Alloc const& alloc = Alloc{});
+  ~ScspUnboundedQueue();
+
+  ScspUnboundedQueue(const ScspUnboundedQueue&) = delete;
+  ScspUnboundedQueue& operator=(const ScspUnboundedQueue&) = delete;
+
+  std::size_t segment_size() const { return SegmentSize; }
+
+  // Approximate when called concurrently with push/pop.
+  std::size_t size() const { return push_cursor_.load(std::memory_order_acquire) - pop_cursor_.load(std::memory_order_acquire); }
+  bool empty() const { return size() == 0; }
+
+  void push(T const&);
+  void push(T&&);
+  template <typename... Args>
+  void emplace(Args&&...);
+  bool pop(T&);
+
+ private:
+  Segment* allocate_segment_();
+  void deallocate_segment_(Segment*);
+};
+
+template <typename T, std::size_t SegmentSize, typename Alloc>
+ScspUnboundedQueue<T, SegmentSize, Alloc>::ScspUnboundedQueue(std::size_t freelist_capacity, Alloc const& alloc)
+    : Alloc{alloc}, freelist_{freelist_capacity} {
+  tail_ = head_ = allocate_segment_();
+}
+
+template <typename T, std::size_t SegmentSize, typename Alloc>
+ScspUnboundedQueue<T, SegmentSize, Alloc>::~ScspUnboundedQueue() {
+  auto push_cursor = push_cursor_.load(std::memory_order_relaxed);
+  auto pop_cursor = pop_cursor_.load(std::memory_order_relaxed);
+
+  // Walk the remaining elements the same way pop() does
+  Segment* segment = head_;
+  for (; pop_cursor != push_cursor; ++pop_cursor) {
+    auto index = pop_cursor % SegmentSize;
+    if (index == 0 && pop_cursor != 0) {
+      segment = segment->next;
+    }
+    segment->element(index)->~T();
+  }
+
+  while (head_ != nullptr) {
+    auto next = head_->next;
+    deallocate_segment_(head_);
+    head_ = next;
+  }
+
+  Segment* spare;
+  while (freelist_.pop(spare)) {
+    deallocate_segment_(spare);
+  }
+}
+
+template <typename T, std::size_t SegmentSize, typename Alloc>
+void ScspUnboundedQueue<T, SegmentSize, Alloc>::push(T const& value) {
+  emplace(value);
+}
+
+template <typename T, std::size_t SegmentSize, typename Alloc>
+void ScspUnboundedQueue<T, SegmentSize, Alloc>::push(T&& value) {
+  emplace(std::move(value));
+}
+
+template <typename T, std::size_t SegmentSize, typename Alloc>
+template <typename... Args>
+void ScspUnboundedQueue<T, SegmentSize, Alloc>::emplace(Args&&... args) {
+  auto push_cursor = push_cursor_.load(std::memory_order_relaxed);
+  auto index = push_cursor % SegmentSize;
+
+  if (index == 0 && push_cursor != 0) {
+    // Current tail is full, link a new segment. The consumer only follows next after the release store below.
+    Segment* segment = nullptr;
+    if (!freelist_.pop(segment)) {
+      segment = allocate_segment_();
+    }
+    segment->next = nullptr;
+    tail_->next = segment;
+    tail_ = segment;
+  }
+
+  new (tail_->element(index)) T(std::forward<Args>(args)...);
+  push_cursor_.store(push_cursor + 1, std::memory_order_release);
+}
+
+template <typename T, std::size_t SegmentSize, typename Alloc>
+bool ScspUnboundedQueue<T, SegmentSize, Alloc>::pop(T& value) {
+  auto pop_cursor = pop_cursor_.load(std::memory_order_relaxed);
+  if (pop_cursor == cached_push_cursor_) {
+    cached_push_cursor_ = push_cursor_.load(std::memory_order_acquire);
+    if (pop_cursor == cached_push_cursor_) {
+      return false;
+    }
+  }
+
+  auto index = pop_cursor % SegmentSize;
+  if (index == 0 && pop_cursor != 0) {
+    // Head is drained, hand it back to the producer
+    auto drained = head_;
+    head_ = head_->next;
+    if (!freelist_.push(drained)) {
+      deallocate_segment_(drained);
+    }
+  }
+
+  auto ptr = head_->element(index);
+  value = std::move(*ptr);
+  ptr->~T();
+  pop_cursor_.store(pop_cursor + 1, std::memory_order_release);
+
+  return true;
+}
+
+template <typename T, std::size_t SegmentSize, typename Alloc>
+typename ScspUnboundedQueue<T, SegmentSize, Alloc>::Segment* ScspUnboundedQueue<T, SegmentSize, Alloc>::allocate_segment_() {
+  SegmentAlloc segment_alloc{*this};
+  auto segment = SegmentAllocTraits::allocate(segment_alloc, 1);
+  return new (segment) Segment;
+}
+
+template <typename T, std::size_t SegmentSize, typename Alloc>
+void ScspUnboundedQueue<T, SegmentSize, Alloc>::deallocate_segment_(Segment* segment) {
+  SegmentAlloc segment_alloc{*this};
+  segment->~Segment();
+  SegmentAllocTraits::deallocate(segment_alloc, segment, 1);
+}
+}  // namespace nyx::data_structure
+
+#endif  // !DATA_STRUCTURE_SCSP_UNBOUNDED_QUEUE_HPP
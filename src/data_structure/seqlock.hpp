@@ -0,0 +1,146 @@
+#ifndef DATA_STRUCTURE_SEQLOCK_HPP
+#define DATA_STRUCTURE_SEQLOCK_HPP
+
+// Sequence lock around a trivially copyable value, for state that is read on every request and written rarely.
+//
+// Readers never write shared memory: they copy the value between two reads of the sequence and retry when a
+// writer was active in between, so reads scale with the number of cores. Writers exclude each other by
+// taking the sequence from even to odd and release it by making it even again.
+// The value is stored as relaxed atomic words, a torn copy is therefore well defined and simply discarded.
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "src/common/include/define.hpp"
+#include "src/data_structure/blocking_scsp_queue.hpp"
+
+namespace nyx::data_structure {
+
+using namespace common::define;
+
+template <typename T>
+class Seqlock {
+  static_assert(std::is_trivially_copyable_v<T>, "Seqlock copies T byte-wise");
+
+  static constexpr std::size_t kWords = (sizeof(T) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+  using Words = std::array<std::uint64_t, kWords>;
+
+  // Odd while a writer is active
+  alignas(hardware_constructive_interference_size) std::atomic<std::uint64_t> sequence_{0};
+  std::atomic<std::uint64_t> words_[kWords];
+
+  char padding_[kPaddingSize];
+
+ public:
+  Seqlock() : Seqlock(T{}) {}
+  explicit Seqlock(const T& value);
+
+  Seqlock(const Seqlock&) = delete;
+  Seqlock& operator=(const Seqlock&) = delete;
+
+  // Lock-free, retries while a writer is active.
+  T load() const noexcept;
+  // Single attempt, returns false if a writer interfered.
+  bool try_load(T* value) const noexcept;
+
+  void store(const T& value) noexcept;
+  // Calls fn(T&) on the current value and stores the result, readers never observe the intermediate state.
+  template <typename Fn>
+  void update(Fn&& fn);
+
+  // Even number, bumped by two on every write.
+  std::uint64_t version() const noexcept { return sequence_.load(std::memory_order_acquire) & ~std::uint64_t{1}; }
+
+ private:
+  std::uint64_t lock_() noexcept;
+  void unlock_(std::uint64_t sequence) noexcept { sequence_.store(sequence + 2, std::memory_order_release); }
+
+  void read_words_(T* value) const noexcept;
+  void write_words_(const T& value) noexcept;
+};
+
+template <typename T>
+Seqlock<T>::Seqlock(const T& value) {
+  write_words_(value);
+}
+
+template <typename T>
+bool Seqlock<T>::try_load(T* value) const noexcept {
+  auto before = sequence_.load(std::memory_order_acquire);
+  if (before & 1) {
+    return false;
+  }
+
+  read_words_(value);
+  // Keeps the word loads above from moving below the second sequence read
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return sequence_.load(std::memory_order_relaxed) == before;
+}
+
+template <typename T>
+T Seqlock<T>::load() const noexcept {
+  T value;
+  while (!try_load(&value)) {
+    wait_strategy::cpu_relax();
+  }
+  return value;
+}
+
+template <typename T>
+void Seqlock<T>::store(const T& value) noexcept {
+  auto sequence = lock_();
+  write_words_(value);
+  unlock_(sequence);
+}
+
+template <typename T>
+template <typename Fn>
+void Seqlock<T>::update(Fn&& fn) {
+  auto sequence = lock_();
+  T value;
+  read_words_(&value);
+  std::forward<Fn>(fn)(value);
+  write_words_(value);
+  unlock_(sequence);
+}
+
+template <typename T>
+std::uint64_t Seqlock<T>::lock_() noexcept {
+  auto sequence = sequence_.load(std::memory_order_relaxed);
+  while (true) {
+    if ((sequence & 1) == 0 && sequence_.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+      break;
+    }
+    wait_strategy::cpu_relax();
+    sequence = sequence_.load(std::memory_order_relaxed);
+  }
+  // Readers that see any of the following word stores also see the odd sequence
+  std::atomic_thread_fence(std::memory_order_release);
+  return sequence;
+}
+
+template <typename T>
+void Seqlock<T>::read_words_(T* value) const noexcept {
+  Words words;
+  for (std::size_t i = 0; i < kWords; ++i) {
+    words[i] = words_[i].load(std::memory_order_relaxed);
+  }
+  std::memcpy(static_cast<void*>(value), words.data(), sizeof(T));
+}
+
+template <typename T>
+void Seqlock<T>::write_words_(const T& value) noexcept {
+  Words words{};
+  std::memcpy(words.data(), static_cast<const void*>(&value), sizeof(T));
+  for (std::size_t i = 0; i < kWords; ++i) {
+    words_[i].store(words[i], std::memory_order_relaxed);
+  }
+}
+}  // namespace nyx::data_structure
+
+#endif  // !DATA_STRUCTURE_SEQLOCK_HPP
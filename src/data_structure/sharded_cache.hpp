@@ -0,0 +1,438 @@
+#ifndef DATA_STRUCTURE_SHARDED_CACHE_HPP
+#define DATA_STRUCTURE_SHARDED_CACHE_HPP
+
+// Concurrent key/value cache split into lock-striped shards. A key always maps to the same shard, every
+// shard owns capacity / shards of the total weight and evicts on its own. The eviction policy is a
+// template parameter:
+//   cache_policy::Lru    - recency list plus index, a hit moves the entry to the front
+//   cache_policy::S3Fifo - small and main FIFO queues plus a ghost queue of recently evicted keys
+//                          (Yang et al., SOSP'23); a hit only bumps a counter, so gets share the shard lock
+// The weight of an entry comes from the Weigher, one per entry by default, the byte size of the value with
+// cache_weigher::Bytes or any callable (const K&, const V&) -> std::size_t.
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "src/common/include/define.hpp"
+
+namespace nyx::data_structure {
+
+using namespace common::define;
+
+namespace cache_weigher {
+struct Count {
+  template <typename K, typename V>
+  std::size_t operator()(const K&, const V&) const noexcept {
+    return 1;
+  }
+};
+
+// Works for values with a size() such as std::string or std::vector<char>
+struct Bytes {
+  template <typename K, typename V>
+  std::size_t operator()(const K&, const V& value) const noexcept {
+    return value.size();
+  }
+};
+}  // namespace cache_weigher
+
+// A policy provides template <K, V, Hash> class Store with
+//   static constexpr bool kSharedGet          - find() may run under a shared lock
+//   const V* find(const K&)                    - records the hit
+//   void insert_or_assign(const K&, V&&, std::size_t weight)
+//   bool erase(const K&)
+//   std::size_t evict(std::size_t capacity)     - evicts until weight() <= capacity, returns how many
+//   std::size_t size() const, std::size_t weight() const
+namespace cache_policy {
+// Not built on UniqueList or FlatUniqueList: both store the key only, with no mapped value or weight, and
+// their lookups return const iterators with no way to move a node. A hit here has to splice the entry to the
+// front and a put has to overwrite the value in place, so the store keeps its own list and index.
+struct Lru {
+  template <typename K, typename V, typename Hash>
+  class Store {
+    struct Entry {
+      K key;
+      V value;
+      std::size_t weight;
+    };
+
+    // Most recently used at the front
+    std::list<Entry> entries_;
+    std::unordered_map<K, typename std::list<Entry>::iterator, Hash> index_;
+    std::size_t weight_{0};
+
+   public:
+    static constexpr bool kSharedGet = false;
+
+    std::size_t size() const noexcept { return index_.size(); }
+    std::size_t weight() const noexcept { return weight_; }
+
+    const V* find(const K& key) {
+      auto it = index_.find(key);
+      if (it == index_.end()) {
+        return nullptr;
+      }
+
+      entries_.splice(entries_.begin(), entries_, it->second);
+      return &it->second->value;
+    }
+
+    void insert_or_assign(const K& key, V&& value, std::size_t weight) {
+      auto it = index_.find(key);
+      if (it != index_.end()) {
+        auto& entry = *it->second;
+        weight_ = weight_ - entry.weight + weight;
+        entry.value = std::move(value);
+        entry.weight = weight;
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return;
+      }
+
+      entries_.push_front(Entry{key, std::move(value), weight});
+      index_.emplace(key, entries_.begin());
+      weight_ += weight;
+    }
+
+    bool erase(const K& key) {
+      auto it = index_.find(key);
+      if (it == index_.end()) {
+        return false;
+      }
+
+      weight_ -= it->second->weight;
+      entries_.erase(it->second);
+      index_.erase(it);
+      return true;
+    }
+
+    std::size_t evict(std::size_t capacity) {
+      std::size_t evicted = 0;
+      while (weight_ > capacity) {
+        auto& victim = entries_.back();
+        weight_ -= victim.weight;
+        index_.erase(victim.key);
+        entries_.pop_back();
+        ++evicted;
+      }
+      return evicted;
+    }
+  };
+};
+
+struct S3Fifo {
+  template <typename K, typename V, typename Hash>
+  class Store {
+    static constexpr std::uint8_t kMaxFrequency = 3;
+
+    struct Entry {
+      K key;
+      V value;
+      std::size_t weight;
+      bool in_main;
+      // Bumped under the shared lock
+      mutable std::atomic<std::uint8_t> frequency{0};
+
+      Entry(const K& key, V&& value, std::size_t weight, bool in_main) : key(key), value(std::move(value)), weight(weight), in_main(in_main) {}
+    };
+
+    using Queue = std::list<Entry>;
+
+    // New entries at the front, both queues evict from the back
+    Queue small_;
+    Queue main_;
+    std::unordered_map<K, typename Queue::iterator, Hash> index_;
+    std::size_t small_weight_{0};
+    std::size_t main_weight_{0};
+
+    // Keys evicted from small_ without a second access; seeing one again admits it straight into main_
+    std::list<K> ghost_;
+    std::unordered_map<K, typename std::list<K>::iterator, Hash> ghost_index_;
+
+   public:
+    static constexpr bool kSharedGet = true;
+
+    std::size_t size() const noexcept { return index_.size(); }
+    std::size_t weight() const noexcept { return small_weight_ + main_weight_; }
+
+    const V* find(const K& key) const {
+      auto it = index_.find(key);
+      if (it == index_.end()) {
+        return nullptr;
+      }
+
+      auto& frequency = it->second->frequency;
+      auto current = frequency.load(std::memory_order_relaxed);
+      if (current < kMaxFrequency) {
+        // Lost updates between concurrent readers are fine, the counter is a hint
+        frequency.store(current + 1, std::memory_order_relaxed);
+      }
+      return &it->second->value;
+    }
+
+    void insert_or_assign(const K& key, V&& value, std::size_t weight) {
+      auto it = index_.find(key);
+      if (it != index_.end()) {
+        auto& entry = *it->second;
+        (entry.in_main ? main_weight_ : small_weight_) += weight - entry.weight;
+        entry.value = std::move(value);
+        entry.weight = weight;
+        return;
+      }
+
+      auto ghost = ghost_index_.find(key);
+      bool in_main = ghost != ghost_index_.end();
+      if (in_main) {
+        ghost_.erase(ghost->second);
+        ghost_index_.erase(ghost);
+      }
+
+      auto& queue = in_main ? main_ : small_;
+      queue.emplace_front(key, std::move(value), weight, in_main);
+      index_.emplace(key, queue.begin());
+      (in_main ? main_weight_ : small_weight_) += weight;
+    }
+
+    bool erase(const K& key) {
+      auto it = index_.find(key);
+      if (it == index_.end()) {
+        return false;
+      }
+
+      auto entry = it->second;
+      (entry->in_main ? main_weight_ : small_weight_) -= entry->weight;
+      (entry->in_main ? main_ : small_).erase(entry);
+      index_.erase(it);
+      return true;
+    }
+
+    std::size_t evict(std::size_t capacity) {
+      std::size_t evicted = 0;
+      while (weight() > capacity) {
+        // small_ gets 10% of the capacity
+        evicted += small_weight_ * 10 >= capacity || main_.empty() ? evict_small_() : evict_main_();
+      }
+      return evicted;
+    }
+
+   private:
+    std::size_t evict_small_() {
+      auto victim = std::prev(small_.end());
+      small_weight_ -= victim->weight;
+
+      // Accessed again while in small_, promote instead of evicting
+      if (victim->frequency.load(std::memory_order_relaxed) > 0) {
+        victim->frequency.store(0, std::memory_order_relaxed);
+        victim->in_main = true;
+        main_.splice(main_.begin(), small_, victim);
+        main_weight_ += victim->weight;
+        return 0;
+      }
+
+      remember_(victim->key);
+      index_.erase(victim->key);
+      small_.erase(victim);
+      return 1;
+    }
+
+    std::size_t evict_main_() {
+      auto victim = std::prev(main_.end());
+
+      // Second chance, decays the counter on every pass
+      auto frequency = victim->frequency.load(std::memory_order_relaxed);
+      if (frequency > 0) {
+        victim->frequency.store(frequency - 1, std::memory_order_relaxed);
+        main_.splice(main_.begin(), main_, victim);
+        return 0;
+      }
+
+      main_weight_ -= victim->weight;
+      index_.erase(victim->key);
+      main_.erase(victim);
+      return 1;
+    }
+
+    void remember_(const K& key) {
+      ghost_.push_front(key);
+      ghost_index_.emplace(key, ghost_.begin());
+
+      // Ghost queue tracks as many keys as the cache holds
+      while (ghost_.size() > std::max<std::size_t>(index_.size(), 1)) {
+        ghost_index_.erase(ghost_.back());
+        ghost_.pop_back();
+      }
+    }
+  };
+};
+}  // namespace cache_policy
+
+template <typename K, typename V, typename Policy = cache_policy::Lru, typename Weigher = cache_weigher::Count, typename Hash = std::hash<K>>
+class ShardedCache : private Weigher {
+  using Store = typename Policy::template Store<K, V, Hash>;
+
+  struct alignas(hardware_constructive_interference_size) Shard {
+    mutable std::shared_mutex mutex;
+    Store store;
+
+    // hits are bumped under the shared lock for policies with kSharedGet
+    std::atomic<std::size_t> hits{0};
+    std::atomic<std::size_t> misses{0};
+    std::size_t insertions{0};
+    std::size_t evictions{0};
+  };
+
+  std::size_t shard_capacity_;
+  std::size_t shard_mask_;
+  std::unique_ptr<Shard[]> shards_;
+  Hash hash_;
+
+ public:
+  struct Stats {
+    std::size_t hits;
+    std::size_t misses;
+    std::size_t insertions;
+    std::size_t evictions;
+
+    double hit_ratio() const noexcept { return hits + misses == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(hits + misses); }
+  };
+
+  // capacity is in Weigher units and split evenly between the shards, shards is rounded up to a power of two.
+  explicit ShardedCache(std::size_t capacity, std::size_t shards = 16, Weigher const& weigher = Weigher{});
+
+  ShardedCache(const ShardedCache&) = delete;
+  ShardedCache& operator=(const ShardedCache&) = delete;
+
+  std::size_t shard_count() const noexcept { return shard_mask_ + 1; }
+  std::size_t capacity() const noexcept { return shard_capacity_ * shard_count(); }
+  // Both walk every shard
+  std::size_t size() const;
+  std::size_t weight() const;
+  Stats stats() const;
+
+  std::optional<V> get(const K&);
+  // Returns false when the entry alone is heavier than a shard, it is not cached then.
+  bool put(const K&, V);
+  bool erase(const K&);
+  void clear();
+
+ private:
+  Shard& shard_(const K& key) const noexcept { return shards_[mix_(hash_(key)) & shard_mask_]; }
+  // Keeps the low bits, which the shard index uses, from lining up with the shard maps' own buckets
+  static std::size_t mix_(std::size_t hash) noexcept { return static_cast<std::size_t>((static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ULL) >> 32); }
+};
+
+template <typename K, typename V, typename Policy, typename Weigher, typename Hash>
+ShardedCache<K, V, Policy, Weigher, Hash>::ShardedCache(std::size_t capacity, std::size_t shards, Weigher const& weigher) : Weigher{weigher} {
+  assert(capacity > 0 && shards > 0);
+  std::size_t count = 1;
+  while (count < shards) {
+    count <<= 1;
+  }
+
+  shard_mask_ = count - 1;
+  shard_capacity_ = std::max<std::size_t>((capacity + count - 1) / count, 1);
+  shards_ = std::make_unique<Shard[]>(count);
+}
+
+template <typename K, typename V, typename Policy, typename Weigher, typename Hash>
+std::size_t ShardedCache<K, V, Policy, Weigher, Hash>::size() const {
+  std::size_t size = 0;
+  for (std::size_t i = 0; i < shard_count(); ++i) {
+    std::shared_lock lock(shards_[i].mutex);
+    size += shards_[i].store.size();
+  }
+  return size;
+}
+
+template <typename K, typename V, typename Policy, typename Weigher, typename Hash>
+std::size_t ShardedCache<K, V, Policy, Weigher, Hash>::weight() const {
+  std::size_t weight = 0;
+  for (std::size_t i = 0; i < shard_count(); ++i) {
+    std::shared_lock lock(shards_[i].mutex);
+    weight += shards_[i].store.weight();
+  }
+  return weight;
+}
+
+template <typename K, typename V, typename Policy, typename Weigher, typename Hash>
+typename ShardedCache<K, V, Policy, Weigher, Hash>::Stats ShardedCache<K, V, Policy, Weigher, Hash>::stats() const {
+  Stats stats{0, 0, 0, 0};
+  for (std::size_t i = 0; i < shard_count(); ++i) {
+    auto& shard = shards_[i];
+    std::shared_lock lock(shard.mutex);
+    stats.hits += shard.hits.load(std::memory_order_relaxed);
+    stats.misses += shard.misses.load(std::memory_order_relaxed);
+    stats.insertions += shard.insertions;
+    stats.evictions += shard.evictions;
+  }
+  return stats;
+}
+
+template <typename K, typename V, typename Policy, typename Weigher, typename Hash>
+std::optional<V> ShardedCache<K, V, Policy, Weigher, Hash>::get(const K& key) {
+  auto& shard = shard_(key);
+
+  auto lookup = [&shard, &key]() -> std::optional<V> {
+    if (const V* value = shard.store.find(key)) {
+      shard.hits.fetch_add(1, std::memory_order_relaxed);
+      return *value;
+    }
+    shard.misses.fetch_add(1, std::memory_order_relaxed);
+    return std::nullopt;
+  };
+
+  if constexpr (Store::kSharedGet) {
+    std::shared_lock lock(shard.mutex);
+    return lookup();
+  } else {
+    std::unique_lock lock(shard.mutex);
+    return lookup();
+  }
+}
+
+template <typename K, typename V, typename Policy, typename Weigher, typename Hash>
+bool ShardedCache<K, V, Policy, Weigher, Hash>::put(const K& key, V value) {
+  auto weight = Weigher::operator()(key, value);
+  auto& shard = shard_(key);
+
+  std::unique_lock lock(shard.mutex);
+  if (weight > shard_capacity_) {
+    shard.store.erase(key);
+    return false;
+  }
+
+  shard.store.insert_or_assign(key, std::move(value), weight);
+  ++shard.insertions;
+  shard.evictions += shard.store.evict(shard_capacity_);
+  return true;
+}
+
+template <typename K, typename V, typename Policy, typename Weigher, typename Hash>
+bool ShardedCache<K, V, Policy, Weigher, Hash>::erase(const K& key) {
+  auto& shard = shard_(key);
+  std::unique_lock lock(shard.mutex);
+  return shard.store.erase(key);
+}
+
+template <typename K, typename V, typename Policy, typename Weigher, typename Hash>
+void ShardedCache<K, V, Policy, Weigher, Hash>::clear() {
+  for (std::size_t i = 0; i < shard_count(); ++i) {
+    std::unique_lock lock(shards_[i].mutex);
+    shards_[i].store = Store{};
+  }
+}
+}  // namespace nyx::data_structure
+
+#endif  // !DATA_STRUCTURE_SHARDED_CACHE_HPP
@@ -0,0 +1,330 @@
+#ifndef DATA_STRUCTURE_SHM_SCSP_QUEUE_HPP
+#define DATA_STRUCTURE_SHM_SCSP_QUEUE_HPP
+
+// ScspLockFreeQueue across processes: the ring and both cursors live in a shared memory mapping.
+//
+// The mapping starts with a header recording the layout (capacity and element size) so that the attaching
+// side can validate it, followed by the ring. The producer and the consumer each map it once and then talk
+// through plain loads and stores, no syscall and no kernel copy per message. Only trivially copyable types
+// can cross the process boundary, and both sides must agree on T.
+// Named queues use shm_open, anonymous ones a memfd (an unlinked shm object outside Linux) whose descriptor is
+// handed to the other process through fork or SCM_RIGHTS.
+//
+// Factories return nullptr on failure with errno describing the cause.
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+
+#include "src/common/include/define.hpp"
+#include "src/utils/include/bitwise.hpp"
+
+namespace nyx::data_structure {
+
+using namespace common::define;
+
+template <typename T>
+class ShmScspQueue {
+  static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be shared between processes");
+
+  // Fixed instead of hardware_constructive_interference_size, the layout is shared between binaries
+  static constexpr std::size_t kLineSize = 64;
+  static_assert(alignof(T) <= kLineSize);
+  static_assert(std::atomic<std::size_t>::is_always_lock_free && std::atomic<std::uint32_t>::is_always_lock_free,
+                "Cursors must be address free to work across processes");
+
+ public:
+  static constexpr std::uint64_t kMagic = 0x4E59585348514555ULL;  // "NYXSHQEU"
+  static constexpr std::uint32_t kVersion = 1;
+
+  struct alignas(kLineSize) Header {
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t element_size;
+    std::uint64_t capacity;
+    std::uint64_t ring_offset;
+    // Set once the creator finished writing the fields above
+    std::atomic<std::uint32_t> ready;
+
+    alignas(kLineSize) std::atomic<std::size_t> push_cursor;
+    alignas(kLineSize) std::atomic<std::size_t> pop_cursor;
+  };
+
+ private:
+  int fd_;
+  std::size_t mapping_size_;
+  Header* header_;
+  T* ring_;
+  std::size_t mask_;
+
+  // Process local, each side only refreshes the cache of the other side's cursor
+  alignas(hardware_constructive_interference_size) std::size_t cached_push_cursor_{0};
+  alignas(hardware_constructive_interference_size) std::size_t cached_pop_cursor_{0};
+
+  char padding_[kPaddingSize];
+
+  ShmScspQueue(int fd, std::size_t mapping_size, Header* header)
+      : fd_(fd),
+        mapping_size_(mapping_size),
+        header_(header),
+        ring_(reinterpret_cast<T*>(reinterpret_cast<char*>(header) + header->ring_offset)),
+        mask_(header->capacity - 1) {}
+
+ public:
+  // Creates the named shared memory object, fails with EEXIST if it already exists. capacity must be a power
+  // of two.
+  static std::unique_ptr<ShmScspQueue> create(const std::string& name, std::size_t capacity);
+  // Maps an existing named queue, fails with EINVAL when its header does not match T and with EAGAIN when
+  // its creator is not done initializing it.
+  static std::unique_ptr<ShmScspQueue> attach(const std::string& name);
+  static bool unlink(const std::string& name) { return shm_unlink(name.c_str()) == 0; }
+
+  // Creates a queue that has no name, share fd() with the other process.
+  static std::unique_ptr<ShmScspQueue> create_anonymous(std::size_t capacity);
+  // Maps the queue behind fd, which is duplicated and stays owned by the caller.
+  static std::unique_ptr<ShmScspQueue> attach_fd(int fd);
+
+  ShmScspQueue(const ShmScspQueue&) = delete;
+  ShmScspQueue& operator=(const ShmScspQueue&) = delete;
+
+  ~ShmScspQueue() {
+    munmap(header_, mapping_size_);
+    close(fd_);
+  }
+
+  int fd() const noexcept { return fd_; }
+  std::size_t capacity() const noexcept { return mask_ + 1; }
+  bool empty() const noexcept {
+    return header_->push_cursor.load(std::memory_order_acquire) == header_->pop_cursor.load(std::memory_order_acquire);
+  }
+
+  // Producer side.
+  bool push(const T& value);
+  // Zero-copy producer side: reserve() returns the next free slot (nullptr when full), commit() publishes it.
+  T* reserve();
+  void commit();
+
+  // Consumer side.
+  bool pop(T& value);
+  // Zero-copy consumer side: front() returns the oldest element (nullptr when empty), consume() releases it.
+  T* front();
+  void consume();
+
+ private:
+  static std::size_t ring_offset_() noexcept { return (sizeof(Header) + alignof(T) - 1) / alignof(T) * alignof(T); }
+  static std::size_t mapping_size_for_(std::size_t capacity) noexcept { return ring_offset_() + capacity * sizeof(T); }
+
+  // Both take ownership of fd and close it on failure
+  static std::unique_ptr<ShmScspQueue> initialize_(int fd, std::size_t capacity);
+  static std::unique_ptr<ShmScspQueue> map_(int fd);
+
+  T* slot_(std::size_t cursor) const noexcept { return &ring_[cursor & mask_]; }
+};
+
+template <typename T>
+std::unique_ptr<ShmScspQueue<T>> ShmScspQueue<T>::create(const std::string& name, std::size_t capacity) {
+  if (!utils::bitwise::is_power_of_two(capacity)) {
+    errno = EINVAL;
+    return nullptr;
+  }
+
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0) {
+    return nullptr;
+  }
+
+  auto queue = initialize_(fd, capacity);
+  if (queue == nullptr) {
+    auto error = errno;
+    shm_unlink(name.c_str());
+    errno = error;
+  }
+  return queue;
+}
+
+template <typename T>
+std::unique_ptr<ShmScspQueue<T>> ShmScspQueue<T>::attach(const std::string& name) {
+  int fd = shm_open(name.c_str(), O_RDWR, 0);
+  if (fd < 0) {
+    return nullptr;
+  }
+  return map_(fd);
+}
+
+template <typename T>
+std::unique_ptr<ShmScspQueue<T>> ShmScspQueue<T>::create_anonymous(std::size_t capacity) {
+  if (!utils::bitwise::is_power_of_two(capacity)) {
+    errno = EINVAL;
+    return nullptr;
+  }
+
+#ifdef __linux__
+  int fd = memfd_create("nyx_shm_scsp_queue", MFD_CLOEXEC);
+#else
+  // Nameless in practice: the name is gone before anyone else could open it
+  static std::atomic<std::uint32_t> counter{0};
+  auto name = "/nyx-" + std::to_string(getpid()) + "-" + std::to_string(counter.fetch_add(1, std::memory_order_relaxed));
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd >= 0) {
+    shm_unlink(name.c_str());
+  }
+#endif
+  if (fd < 0) {
+    return nullptr;
+  }
+  return initialize_(fd, capacity);
+}
+
+template <typename T>
+std::unique_ptr<ShmScspQueue<T>> ShmScspQueue<T>::attach_fd(int fd) {
+  int own = dup(fd);
+  if (own < 0) {
+    return nullptr;
+  }
+  return map_(own);
+}
+
+template <typename T>
+std::unique_ptr<ShmScspQueue<T>> ShmScspQueue<T>::initialize_(int fd, std::size_t capacity) {
+  auto size = mapping_size_for_(capacity);
+  void* mapping = MAP_FAILED;
+  if (ftruncate(fd, static_cast<off_t>(size)) == 0) {
+    mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  }
+  if (mapping == MAP_FAILED) {
+    auto error = errno;
+    close(fd);
+    errno = error;
+    return nullptr;
+  }
+
+  // Fresh pages are zeroed, so ready reads 0 until the store below
+  auto* header = new (mapping) Header{};
+  header->magic = kMagic;
+  header->version = kVersion;
+  header->element_size = sizeof(T);
+  header->capacity = capacity;
+  header->ring_offset = ring_offset_();
+  header->ready.store(1, std::memory_order_release);
+
+  return std::unique_ptr<ShmScspQueue>(new ShmScspQueue(fd, size, header));
+}
+
+template <typename T>
+std::unique_ptr<ShmScspQueue<T>> ShmScspQueue<T>::map_(int fd) {
+  auto fail = [fd](int error, void* mapping = MAP_FAILED, std::size_t size = 0) -> std::unique_ptr<ShmScspQueue> {
+    if (mapping != MAP_FAILED) {
+      munmap(mapping, size);
+    }
+    close(fd);
+    errno = error;
+    return nullptr;
+  };
+
+  struct stat info;
+  if (fstat(fd, &info) != 0) {
+    return fail(errno);
+  }
+  auto size = static_cast<std::size_t>(info.st_size);
+  if (size < sizeof(Header)) {
+    return fail(EAGAIN);
+  }
+
+  void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (mapping == MAP_FAILED) {
+    return fail(errno);
+  }
+
+  auto* header = static_cast<Header*>(mapping);
+  if (header->ready.load(std::memory_order_acquire) == 0) {
+    return fail(EAGAIN, mapping, size);
+  }
+  if (header->magic != kMagic || header->version != kVersion || header->element_size != sizeof(T) ||
+      !utils::bitwise::is_power_of_two(header->capacity) || header->ring_offset != ring_offset_() || size < mapping_size_for_(header->capacity)) {
+    return fail(EINVAL, mapping, size);
+  }
+
+  auto queue = std::unique_ptr<ShmScspQueue>(new ShmScspQueue(fd, size, header));
+  queue->cached_push_cursor_ = header->push_cursor.load(std::memory_order_acquire);
+  queue->cached_pop_cursor_ = header->pop_cursor.load(std::memory_order_acquire);
+  return queue;
+}
+
+template <typename T>
+T* ShmScspQueue<T>::reserve() {
+  auto push_cursor = header_->push_cursor.load(std::memory_order_relaxed);
+  if (push_cursor - cached_pop_cursor_ == capacity()) {
+    cached_pop_cursor_ = header_->pop_cursor.load(std::memory_order_acquire);
+    if (push_cursor - cached_pop_cursor_ == capacity()) {
+      return nullptr;
+    }
+  }
+
+  return slot_(push_cursor);
+}
+
+template <typename T>
+void ShmScspQueue<T>::commit() {
+  auto push_cursor = header_->push_cursor.load(std::memory_order_relaxed);
+  assert(push_cursor - cached_pop_cursor_ < capacity());
+  header_->push_cursor.store(push_cursor + 1, std::memory_order_release);
+}
+
+template <typename T>
+bool ShmScspQueue<T>::push(const T& value) {
+  auto* slot = reserve();
+  if (slot == nullptr) {
+    return false;
+  }
+
+  std::memcpy(static_cast<void*>(slot), &value, sizeof(T));
+  commit();
+  return true;
+}
+
+template <typename T>
+T* ShmScspQueue<T>::front() {
+  auto pop_cursor = header_->pop_cursor.load(std::memory_order_relaxed);
+  if (cached_push_cursor_ == pop_cursor) {
+    cached_push_cursor_ = header_->push_cursor.load(std::memory_order_acquire);
+    if (cached_push_cursor_ == pop_cursor) {
+      return nullptr;
+    }
+  }
+
+  return slot_(pop_cursor);
+}
+
+template <typename T>
+void ShmScspQueue<T>::consume() {
+  auto pop_cursor = header_->pop_cursor.load(std::memory_order_relaxed);
+  assert(cached_push_cursor_ != pop_cursor);
+  header_->pop_cursor.store(pop_cursor + 1, std::memory_order_release);
+}
+
+template <typename T>
+bool ShmScspQueue<T>::pop(T& value) {
+  auto* slot = front();
+  if (slot == nullptr) {
+    return false;
+  }
+
+  std::memcpy(static_cast<void*>(&value), slot, sizeof(T));
+  consume();
+  return true;
+}
+}  // namespace nyx::data_structure
+
+#endif  // !DATA_STRUCTURE_SHM_SCSP_QUEUE_HPP
@@ -0,0 +1,421 @@
+#ifndef DATA_STRUCTURE_SKIPLIST_HPP
+#define DATA_STRUCTURE_SKIPLIST_HPP
+
+// Lock-free ordered map / set (Fraser's skiplist, as presented by Herlihy and Shavit).
+//
+// Every node is linked at level 0 and at a random number of express levels above it. Erasing a node marks
+// the low bit of each of its next pointers, top level first; whoever marks level 0 owns the erase. Marked
+// nodes are unlinked by the CAS-based searches of insert and erase, while lookups and iterators only skip
+// them and never write, so they are wait-free.
+// A node is retired through epoch-based reclamation once both its eraser and its inserter (which may still
+// be linking upper levels) are done with it. Iterators pin the epoch for as long as they live, so keep them
+// short-lived: a long-lived iterator holds back reclamation for the whole process. Pins belong to the calling
+// thread, so an iterator must be destroyed on the thread that created it.
+
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "src/common/include/define.hpp"
+#include "src/memory/include/epoch.hpp"
+
+namespace nyx::data_structure {
+
+using namespace common::define;
+
+// V = void makes a set of K.
+template <typename K, typename V, typename Compare = std::less<K>>
+class SkipList : private Compare {
+  static constexpr int kMaxLevel = 32;
+  static constexpr std::uintptr_t kMarked = 1;
+
+ public:
+  using key_type = K;
+  using value_type = std::conditional_t<std::is_void_v<V>, K, std::pair<const K, V>>;
+  using key_compare = Compare;
+
+ private:
+  struct alignas(std::atomic<std::uintptr_t>) Node {
+    value_type value;
+    int level;
+    // Set by the eraser and by the inserter once done, the second one retires the node
+    std::atomic<std::uint8_t> released{0};
+
+    std::atomic<std::uintptr_t>* next() noexcept { return reinterpret_cast<std::atomic<std::uintptr_t>*>(this + 1); }
+    const K& key() const noexcept {
+      if constexpr (std::is_void_v<V>) {
+        return value;
+      } else {
+        return value.first;
+      }
+    }
+  };
+  static_assert(sizeof(Node) % alignof(std::atomic<std::uintptr_t>) == 0);
+
+  // Links of a predecessor, either head_ or the next array of a node
+  using Links = std::atomic<std::uintptr_t>*;
+
+  alignas(hardware_constructive_interference_size) std::atomic<std::uintptr_t> head_[kMaxLevel];
+  // Highest level ever used, searches start there
+  alignas(hardware_constructive_interference_size) std::atomic<int> height_{1};
+  alignas(hardware_constructive_interference_size) std::atomic<std::size_t> size_{0};
+
+  char padding_[kPaddingSize];
+
+ public:
+  // Forward iterator over the nodes at level 0, skipping erased ones. Pins the epoch while it lives.
+  class Iterator {
+    friend class SkipList;
+
+    Node* node_{nullptr};
+
+    explicit Iterator(Node* node) : node_(node) { memory::epoch::pin(); }
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = SkipList::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+
+    Iterator() { memory::epoch::pin(); }
+    Iterator(const Iterator& other) : node_(other.node_) { memory::epoch::pin(); }
+    Iterator& operator=(const Iterator& other) {
+      node_ = other.node_;
+      return *this;
+    }
+    ~Iterator() { memory::epoch::unpin(); }
+
+    reference operator*() const { return node_->value; }
+    pointer operator->() const { return &node_->value; }
+
+    Iterator& operator++() {
+      node_ = live_from_(ptr_(node_->next()[0].load(std::memory_order_acquire)));
+      return *this;
+    }
+    Iterator operator++(int) {
+      auto copy = *this;
+      ++*this;
+      return copy;
+    }
+
+    bool operator==(const Iterator& other) const { return node_ == other.node_; }
+  };
+
+  using iterator = Iterator;
+  using const_iterator = Iterator;
+
+ public:
+  explicit SkipList(Compare const& compare = Compare{});
+  ~SkipList();
+
+  SkipList(const SkipList&) = delete;
+  SkipList& operator=(const SkipList&) = delete;
+
+  // Constructs the element from key and args when key is absent. Returns false when it was present.
+  template <typename... Args>
+  bool insert(const K& key, Args&&... args);
+  // Returns false when key was absent or another thread erased it first.
+  bool erase(const K&);
+
+  iterator find(const K&) const;
+  bool contains(const K& key) const { return find(key) != end(); }
+  // First element not less than key
+  iterator lower_bound(const K&) const;
+  // First element greater than key, the "next key after X" query
+  iterator upper_bound(const K&) const;
+
+  iterator begin() const;
+  iterator end() const { return iterator(nullptr); }
+
+  // Approximate when other threads are writing.
+  std::size_t size() const noexcept { return size_.load(std::memory_order_relaxed); }
+  bool empty() const noexcept { return begin() == end(); }
+
+ private:
+  static Node* ptr_(std::uintptr_t link) noexcept { return reinterpret_cast<Node*>(link & ~kMarked); }
+  static bool marked_(std::uintptr_t link) noexcept { return (link & kMarked) != 0; }
+  static std::uintptr_t link_(Node* node) noexcept { return reinterpret_cast<std::uintptr_t>(node); }
+
+  // First node at level 0 from node on that is not erased
+  static Node* live_from_(Node*) noexcept;
+
+  bool less_(const K& lhs, const K& rhs) const { return Compare::operator()(lhs, rhs); }
+  // Walks down to level 0 without writing. Returns the first node whose key is not less than key (or
+  // greater than key when Upper), erased nodes are skipped.
+  template <bool Upper>
+  Node* seek_(const K&) const;
+  // Fills preds and succs with the neighbours of key on every level up to height, unlinking the marked
+  // nodes on the way. Returns true when succs[0] holds key.
+  bool search_(const K&, Links* preds, Node** succs);
+  void release_(Node*);
+
+  static int random_level_() noexcept;
+  template <typename... Args>
+  static Node* create_(int level, Args&&... args);
+  static void destroy_(void* node) noexcept;
+};
+
+template <typename K, typename Compare = std::less<K>>
+using SkipListSet = SkipList<K, void, Compare>;
+template <typename K, typename V, typename Compare = std::less<K>>
+using SkipListMap = SkipList<K, V, Compare>;
+
+template <typename K, typename V, typename Compare>
+SkipList<K, V, Compare>::SkipList(Compare const& compare) : Compare{compare} {
+  for (auto& link : head_) {
+    link.store(0, std::memory_order_relaxed);
+  }
+}
+
+template <typename K, typename V, typename Compare>
+SkipList<K, V, Compare>::~SkipList() {
+  // Without concurrent writers every node still linked at level 0 is unmarked and owned by the list
+  for (auto* node = ptr_(head_[0].load(std::memory_order_acquire)); node != nullptr;) {
+    destroy_(std::exchange(node, ptr_(node->next()[0].load(std::memory_order_relaxed))));
+  }
+}
+
+template <typename K, typename V, typename Compare>
+template <typename... Args>
+bool SkipList<K, V, Compare>::insert(const K& key, Args&&... args) {
+  memory::epoch::Guard guard;
+
+  int level = random_level_();
+  for (auto height = height_.load(std::memory_order_relaxed); height < level;) {
+    if (height_.compare_exchange_weak(height, level, std::memory_order_acq_rel)) {
+      break;
+    }
+  }
+
+  Links preds[kMaxLevel];
+  Node* succs[kMaxLevel];
+  Node* node = nullptr;
+  while (true) {
+    if (search_(key, preds, succs)) {
+      if (node != nullptr) {
+        destroy_(node);
+      }
+      return false;
+    }
+
+    if (node == nullptr) {
+      if constexpr (std::is_void_v<V>) {
+        node = create_(level, key);
+      } else {
+        node = create_(level, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+      }
+    }
+    for (int i = 0; i < level; ++i) {
+      node->next()[i].store(link_(succs[i]), std::memory_order_relaxed);
+    }
+
+    // Linking level 0 inserts the element, the other levels only speed up searches
+    auto expected = link_(succs[0]);
+    if (preds[0][0].compare_exchange_strong(expected, link_(node), std::memory_order_release, std::memory_order_relaxed)) {
+      break;
+    }
+  }
+  size_.fetch_add(1, std::memory_order_relaxed);
+
+  for (int i = 1; i < level; ++i) {
+    while (true) {
+      // An eraser may have marked the level already, then the node must not be linked there any more
+      auto next = node->next()[i].load(std::memory_order_acquire);
+      if (marked_(next)) {
+        break;
+      }
+      if (ptr_(next) != succs[i] &&
+          !node->next()[i].compare_exchange_strong(next, link_(succs[i]), std::memory_order_release, std::memory_order_relaxed)) {
+        break;
+      }
+
+      auto expected = link_(succs[i]);
+      if (preds[i][i].compare_exchange_strong(expected, link_(node), std::memory_order_release, std::memory_order_relaxed)) {
+        break;
+      }
+      search_(key, preds, succs);
+      if (succs[0] != node) {
+        // Erased and unlinked meanwhile
+        break;
+      }
+    }
+  }
+
+  // An erase that raced with the linking above may have missed the levels linked after its search
+  if (marked_(node->next()[0].load(std::memory_order_acquire))) {
+    search_(key, preds, succs);
+  }
+  release_(node);
+  return true;
+}
+
+template <typename K, typename V, typename Compare>
+bool SkipList<K, V, Compare>::erase(const K& key) {
+  memory::epoch::Guard guard;
+
+  Links preds[kMaxLevel];
+  Node* succs[kMaxLevel];
+  if (!search_(key, preds, succs)) {
+    return false;
+  }
+
+  auto* node = succs[0];
+  for (int i = node->level - 1; i > 0; --i) {
+    auto next = node->next()[i].load(std::memory_order_relaxed);
+    while (!marked_(next) && !node->next()[i].compare_exchange_weak(next, next | kMarked, std::memory_order_acq_rel)) {
+    }
+  }
+
+  auto next = node->next()[0].load(std::memory_order_relaxed);
+  while (!marked_(next)) {
+    if (node->next()[0].compare_exchange_weak(next, next | kMarked, std::memory_order_acq_rel)) {
+      size_.fetch_sub(1, std::memory_order_relaxed);
+      // Unlinks the node from every level
+      search_(key, preds, succs);
+      release_(node);
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename K, typename V, typename Compare>
+typename SkipList<K, V, Compare>::iterator SkipList<K, V, Compare>::find(const K& key) const {
+  memory::epoch::Guard guard;
+  auto* node = seek_<false>(key);
+  if (node == nullptr || less_(key, node->key())) {
+    return end();
+  }
+  return iterator(node);
+}
+
+template <typename K, typename V, typename Compare>
+typename SkipList<K, V, Compare>::iterator SkipList<K, V, Compare>::lower_bound(const K& key) const {
+  memory::epoch::Guard guard;
+  return iterator(seek_<false>(key));
+}
+
+template <typename K, typename V, typename Compare>
+typename SkipList<K, V, Compare>::iterator SkipList<K, V, Compare>::upper_bound(const K& key) const {
+  memory::epoch::Guard guard;
+  return iterator(seek_<true>(key));
+}
+
+template <typename K, typename V, typename Compare>
+typename SkipList<K, V, Compare>::iterator SkipList<K, V, Compare>::begin() const {
+  // The first nodes may be erased and retired while live_from_ walks past them
+  memory::epoch::Guard guard;
+  return iterator(live_from_(ptr_(head_[0].load(std::memory_order_acquire))));
+}
+
+template <typename K, typename V, typename Compare>
+typename SkipList<K, V, Compare>::Node* SkipList<K, V, Compare>::live_from_(Node* node) noexcept {
+  while (node != nullptr) {
+    auto next = node->next()[0].load(std::memory_order_acquire);
+    if (!marked_(next)) {
+      return node;
+    }
+    node = ptr_(next);
+  }
+  return nullptr;
+}
+
+template <typename K, typename V, typename Compare>
+template <bool Upper>
+typename SkipList<K, V, Compare>::Node* SkipList<K, V, Compare>::seek_(const K& key) const {
+  const std::atomic<std::uintptr_t>* links = head_;
+  Node* curr = nullptr;
+  for (int level = height_.load(std::memory_order_acquire) - 1; level >= 0; --level) {
+    curr = ptr_(links[level].load(std::memory_order_acquire));
+    while (curr != nullptr) {
+      auto next = curr->next()[level].load(std::memory_order_acquire);
+      if (marked_(next)) {
+        curr = ptr_(next);
+        continue;
+      }
+      if (Upper ? less_(key, curr->key()) : !less_(curr->key(), key)) {
+        break;
+      }
+      links = curr->next();
+      curr = ptr_(next);
+    }
+  }
+  return curr;
+}
+
+template <typename K, typename V, typename Compare>
+bool SkipList<K, V, Compare>::search_(const K& key, Links* preds, Node** succs) {
+retry:
+  Links links = head_;
+  for (int level = height_.load(std::memory_order_acquire) - 1; level >= 0; --level) {
+    auto curr = ptr_(links[level].load(std::memory_order_acquire));
+    while (curr != nullptr) {
+      auto next = curr->next()[level].load(std::memory_order_acquire);
+      if (marked_(next)) {
+        // curr is being erased, unlink it here. Fails when the predecessor changed or got marked itself.
+        auto expected = link_(curr);
+        if (!links[level].compare_exchange_strong(expected, next & ~kMarked, std::memory_order_acq_rel, std::memory_order_acquire)) {
+          goto retry;
+        }
+        curr = ptr_(next);
+        continue;
+      }
+      if (!less_(curr->key(), key)) {
+        break;
+      }
+      links = curr->next();
+      curr = ptr_(next);
+    }
+    preds[level] = links;
+    succs[level] = curr;
+  }
+  return succs[0] != nullptr && !less_(key, succs[0]->key());
+}
+
+template <typename K, typename V, typename Compare>
+void SkipList<K, V, Compare>::release_(Node* node) {
+  if (node->released.fetch_add(1, std::memory_order_acq_rel) == 1) {
+    memory::epoch::retire(node, &destroy_);
+  }
+}
+
+template <typename K, typename V, typename Compare>
+int SkipList<K, V, Compare>::random_level_() noexcept {
+  // xorshift per thread, every level is kept with probability 1/2
+  thread_local std::uint64_t state = 0x9E3779B97F4A7C15ULL ^ reinterpret_cast<std::uintptr_t>(&state);
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return std::countr_zero(static_cast<std::uint32_t>(state >> 32) | (std::uint32_t{1} << (kMaxLevel - 1))) + 1;
+}
+
+template <typename K, typename V, typename Compare>
+template <typename... Args>
+typename SkipList<K, V, Compare>::Node* SkipList<K, V, Compare>::create_(int level, Args&&... args) {
+  // The next pointers of a node are stored right after it, a node only pays for the levels it has
+  void* memory = ::operator new(sizeof(Node) + level * sizeof(std::atomic<std::uintptr_t>), std::align_val_t{alignof(Node)});
+  auto* node = new (memory) Node{value_type(std::forward<Args>(args)...), level};
+  for (int i = 0; i < level; ++i) {
+    new (&node->next()[i]) std::atomic<std::uintptr_t>(0);
+  }
+  return node;
+}
+
+template <typename K, typename V, typename Compare>
+void SkipList<K, V, Compare>::destroy_(void* memory) noexcept {
+  auto* node = static_cast<Node*>(memory);
+  node->~Node();
+  ::operator delete(memory, std::align_val_t{alignof(Node)});
+}
+}  // namespace nyx::data_structure
+
+#endif  // !DATA_STRUCTURE_SKIPLIST_HPP
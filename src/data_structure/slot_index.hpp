@@ -0,0 +1,114 @@
+#ifndef DATA_STRUCTURE_SLOT_INDEX_HPP
+#define DATA_STRUCTURE_SLOT_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace nyx::data_structure {
+// Linear-probing table from an element to the id of the slot holding it, for containers that keep their
+// elements in a slab of slots. Each entry caches the 32-bit hash next to the slot id, so probing, erasing
+// and rehashing compare and move hashes without touching the slab; only a hash match calls back into the
+// container to compare the element itself.
+class SlotIndex {
+ public:
+  static constexpr std::uint32_t npos = UINT32_MAX;
+
+ private:
+  struct Entry {
+    std::uint32_t slot{npos};
+    std::uint32_t hash{0};
+  };
+
+  std::vector<Entry> entries_;
+  std::size_t mask_;
+
+ public:
+  SlotIndex() : entries_(16), mask_(15) {}
+
+  // std::hash is the identity for integers, spread it before taking the low bits as home position
+  static std::uint32_t spread(std::size_t hash) noexcept {
+    return static_cast<std::uint32_t>((static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ULL) >> 32);
+  }
+
+  // Slot whose hash is hash and for which match(slot) holds, or npos
+  template <typename Match>
+  std::uint32_t find(std::uint32_t hash, Match&& match) const noexcept;
+  // slot must not be in the index yet, call reserve() first to keep the load factor
+  void insert(std::uint32_t slot, std::uint32_t hash) noexcept;
+  // slot must be in the index under hash
+  void erase(std::uint32_t slot, std::uint32_t hash) noexcept;
+  // Rehashes into a larger table when size entries would exceed the load factor
+  void reserve(std::size_t size);
+  // Capacity is kept
+  void clear() noexcept;
+};
+
+template <typename Match>
+std::uint32_t SlotIndex::find(std::uint32_t hash, Match&& match) const noexcept {
+  for (std::size_t pos = hash & mask_;; pos = (pos + 1) & mask_) {
+    const auto& entry = entries_[pos];
+    if (entry.slot == npos) {
+      return npos;
+    }
+    if (entry.hash == hash && match(entry.slot)) {
+      return entry.slot;
+    }
+  }
+}
+
+inline void SlotIndex::insert(std::uint32_t slot, std::uint32_t hash) noexcept {
+  auto pos = hash & mask_;
+  while (entries_[pos].slot != npos) {
+    pos = (pos + 1) & mask_;
+  }
+  entries_[pos] = Entry{slot, hash};
+}
+
+inline void SlotIndex::erase(std::uint32_t slot, std::uint32_t hash) noexcept {
+  auto hole = hash & mask_;
+  while (entries_[hole].slot != slot) {
+    hole = (hole + 1) & mask_;
+  }
+
+  // Backward shift deletion: pull later entries of the cluster into the hole unless that would move
+  // them in front of their home position. Keeps probing free of tombstones.
+  for (auto pos = (hole + 1) & mask_; entries_[pos].slot != npos; pos = (pos + 1) & mask_) {
+    auto home = entries_[pos].hash & mask_;
+    if (((pos - home) & mask_) >= ((pos - hole) & mask_)) {
+      entries_[hole] = entries_[pos];
+      hole = pos;
+    }
+  }
+  entries_[hole] = Entry{};
+}
+
+inline void SlotIndex::reserve(std::size_t size) {
+  // Keep the load factor at or below 3/4
+  std::size_t capacity = entries_.size();
+  while (size * 4 > capacity * 3) {
+    capacity <<= 1;
+  }
+  if (capacity == entries_.size()) {
+    return;
+  }
+
+  std::vector<Entry> old_entries(capacity);
+  old_entries.swap(entries_);
+  mask_ = capacity - 1;
+
+  for (const auto& entry : old_entries) {
+    if (entry.slot != npos) {
+      insert(entry.slot, entry.hash);
+    }
+  }
+}
+
+inline void SlotIndex::clear() noexcept {
+  for (auto& entry : entries_) {
+    entry = Entry{};
+  }
+}
+}  // namespace nyx::data_structure
+
+#endif  // !DATA_STRUCTURE_SLOT_INDEX_HPP
@@ -1,142 +1,232 @@
 #ifndef DATA_STRUCTURE_STEALING_WORK_QUEUE_HPP
 #define DATA_STRUCTURE_STEALING_WORK_QUEUE_HPP
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <utility>
 
 #include "src/common/include/define.hpp"
+#include "src/data_structure/lockfree_growing_circular_array.hpp"
 
 namespace nyx::data_structure {
 using namespace common::define;
 
+// Chase-Lev work stealing deque. The owner pushes and pops at the bottom, thieves steal from the top.
+// Items are boxed so that slots only ever hold T*, which is what thieves read concurrently.
+//
+// Indices are 32 bit and wrap, top_ packs the top index with a tag in its upper half. steal_batch()
+// claims up to half of the deque with a single CAS on top_. A thief that read a stale bottom could
+// then claim slots the owner already popped without a CAS, so the owner keeps bot_high_, an upper
+// bound of every bottom a thief holding the current tag may have read, and bumps the tag before it
+// pops a slot such a thief could reach. That happens at most once per halving of the deque.
 template <typename T>
 class StealingWorkQueue {
-  struct CircularAtomicArray {
-    size_t cap;
-    std::atomic<T*> elements;
+  using Index = std::uint32_t;
+  using Array = LockfreeGrowingCircularArray<T, 64, (std::size_t{1} << 30)>;
 
-    CircularAtomicArray() = delete;
-    explicit CircularAtomicArray(size_t capacity) : cap(capacity), elements{new T[capacity]} {}
-
-    ~CircularAtomicArray() { delete[] elements; }
-
-    size_t capacity() const noexcept { return cap; }
-
-    void push(size_t index, T&& value) { elements[index & cap] = std::forward<T>(value); }
-    T pop(size_t index) { return elements[index & cap]; }
-
-    CircularAtomicArray* resize(size_t bot, size_t top) {
-      CircularAtomicArray* ptr = new CircularAtomicArray{2 * cap};
-      for (size_t i = top; i != bot; ++i) {
-        ptr->push(i, pop(i));
-      }
-      return ptr;
-    }
-  };
-
-  alignas(hardware_constructive_interference_size) std::atomic<std::size_t> top_;
-  alignas(hardware_constructive_interference_size) std::atomic<std::size_t> bot_;
-  std::atomic<CircularAtomicArray*> array_;
+  alignas(hardware_constructive_interference_size) std::atomic<std::uint64_t> top_;
+  alignas(hardware_constructive_interference_size) std::atomic<Index> bot_;
+  Index bot_high_;  // owner only
+  Array array_;
 
  public:
   explicit StealingWorkQueue(size_t cap = 1024);
   ~StealingWorkQueue();
 
+  StealingWorkQueue(const StealingWorkQueue&) = delete;
+  StealingWorkQueue& operator=(const StealingWorkQueue&) = delete;
+
   bool empty() const noexcept;
   size_t size() const noexcept;
-  size_t capacity() const noexcept { return array_.load(std::memory_order_relaxed)->capacity(); }
+  size_t capacity() const noexcept { return array_.capacity(); }
 
-  void push(T&&);
+  // Owner only. Returns false when the deque is full and already at its maximum capacity.
+  bool push(T&&);
+  // Owner only.
   std::optional<T> pop();
   std::optional<T> steal();
+  // Moves up to max items, and at most half of this deque rounded up, into dest, which must be owned by the
+  // calling thread. Returns the number of items moved.
+  size_t steal_batch(StealingWorkQueue& dest, size_t max = SIZE_MAX);
+
+ private:
+  static Index index_(std::uint64_t top) noexcept { return static_cast<Index>(top); }
+  static std::uint32_t tag_(std::uint64_t top) noexcept { return static_cast<std::uint32_t>(top >> 32); }
+  static std::uint64_t pack_(Index index, std::uint32_t tag) noexcept { return (std::uint64_t{tag} << 32) | index; }
+  static std::int32_t distance_(Index bot, Index top) noexcept { return static_cast<std::int32_t>(bot - top); }
+
+  // Owner only. Makes room for count more items, returns how many fit.
+  size_t reserve_(size_t count);
+  static std::optional<T> take_(T* item);
 };
 
 template <typename T>
-StealingWorkQueue<T>::StealingWorkQueue(size_t cap) {
+StealingWorkQueue<T>::StealingWorkQueue(size_t cap) : bot_high_(0), array_(cap) {
   top_.store(0, std::memory_order_relaxed);
   bot_.store(0, std::memory_order_relaxed);
-  array_.store(new CircularAtomicArray{cap}, std::memory_order_relaxed);
 }
 
 template <typename T>
 StealingWorkQueue<T>::~StealingWorkQueue() {
-  delete array_.load();
+  Index bot = bot_.load(std::memory_order_relaxed);
+  for (Index i = index_(top_.load(std::memory_order_relaxed)); distance_(bot, i) > 0; ++i) {
+    delete array_.get(i, std::memory_order_relaxed);
+  }
 }
 
 template <typename T>
 bool StealingWorkQueue<T>::empty() const noexcept {
-  size_t bot = bot_.load(std::memory_order_relaxed);
-  size_t top = top_.load(std::memory_order_relaxed);
-  return bot <= top;
+  return size() == 0;
 }
 
 template <typename T>
 size_t StealingWorkQueue<T>::size() const noexcept {
-  size_t bot = bot_.load(std::memory_order_relaxed);
-  size_t top = top_.load(std::memory_order_relaxed);
-  return bot >= top ? bot - top : 0;
+  Index bot = bot_.load(std::memory_order_relaxed);
+  Index top = index_(top_.load(std::memory_order_relaxed));
+  auto distance = distance_(bot, top);
+  return distance > 0 ? static_cast<size_t>(distance) : 0;
 }
 
 template <typename T>
-void StealingWorkQueue<T>::push(T&& value) {
-  size_t bot = bot_.load(std::memory_order_relaxed);
-  size_t top = top_.load(std::memory_order_acquire);
-  CircularAtomicArray* a = array_.load(std::memory_order_relaxed);
-
-  if (a->capacity() < bot - top + 1) {
-    // queue is full, need to resize
-    auto temp = a->resize(bot, top);
-    std::swap(temp, a);
-    delete[] temp;
-    array_.store(a, std::memory_order_relaxed);
+bool StealingWorkQueue<T>::push(T&& value) {
+  if (reserve_(1) == 0) {
+    return false;
+  }
+
+  Index bot = bot_.load(std::memory_order_relaxed);
+  array_.put(bot, new T(std::forward<T>(value)), std::memory_order_relaxed);
+  bot_.store(bot + 1, std::memory_order_release);
+  if (distance_(bot + 1, bot_high_) > 0) {
+    bot_high_ = bot + 1;
   }
 
-  a->push(bot, std::forward<T>(value));
-  std::atomic_thread_fence(std::memory_order_release);
-  bot_.store(bot + 1, std::memory_order_relaxed);
+  return true;
 }
 
 template <typename T>
 std::optional<T> StealingWorkQueue<T>::pop() {
-  size_t bot = bot_.load(std::memory_order_relaxed) - 1;
-  CircularAtomicArray* a = array_.load(std::memory_order_relaxed);
+  Index bot = bot_.load(std::memory_order_relaxed) - 1;
   bot_.store(bot, std::memory_order_relaxed);
   std::atomic_thread_fence(std::memory_order_seq_cst);
-  size_t top = top_.load(std::memory_order_relaxed);
-
-  std::optional<T> ret;
-  if (top <= bot) {
-    ret = a->pop(bot);
-    if (top == bot) {
-      if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
-        ret = std::nullopt;
+  std::uint64_t top = top_.load(std::memory_order_relaxed);
+
+  while (true) {
+    auto distance = distance_(bot, index_(top));
+    if (distance < 0) {
+      // queue is empty
+      bot_.store(bot + 1, std::memory_order_relaxed);
+      return std::nullopt;
+    }
+
+    T* item = array_.get(bot, std::memory_order_relaxed);
+    if (distance == 0) {
+      // last item, race against thieves for it
+      if (!top_.compare_exchange_strong(top, pack_(index_(top) + 1, tag_(top)), std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        item = nullptr;
       }
       bot_.store(bot + 1, std::memory_order_relaxed);
+      return take_(item);
     }
-  } else {
-    bot_.store(bot + 1, std::memory_order_relaxed);
-  }
 
-  return ret;
+    // A thief holding this top and a bottom up to bot_high_ claims at most half of that range
+    if (distance >= (distance_(bot_high_, index_(top)) + 1) / 2) {
+      return take_(item);
+    }
+
+    // Invalidate those thieves. Once the tag moved, every thief reads a bottom not above bot.
+    if (top_.compare_exchange_strong(top, pack_(index_(top), tag_(top) + 1), std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      bot_high_ = bot;
+      return take_(item);
+    }
+    // top moved, check again against the fresh value
+  }
 }
 
 template <typename T>
 std::optional<T> StealingWorkQueue<T>::steal() {
-  size_t top = top_.load(std::memory_order_acquire);
+  std::uint64_t top = top_.load(std::memory_order_acquire);
   std::atomic_thread_fence(std::memory_order_seq_cst);
-  size_t bot = bot_.load(std::memory_order_acquire);
+  Index bot = bot_.load(std::memory_order_acquire);
 
-  std::optional<T> ret;
-  if (top < bot) {
-    CircularAtomicArray* a = array_.load(std::memory_order_consume);
-    ret = a->pop(top);
-    if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
-      return std::nullopt;
-    }
+  if (distance_(bot, index_(top)) <= 0) {
+    return std::nullopt;
+  }
+
+  T* item = array_.get(index_(top), std::memory_order_relaxed);
+  if (!top_.compare_exchange_strong(top, pack_(index_(top) + 1, tag_(top)), std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    return std::nullopt;
+  }
+
+  return take_(item);
+}
+
+template <typename T>
+size_t StealingWorkQueue<T>::steal_batch(StealingWorkQueue& dest, size_t max) {
+  if (&dest == this || max == 0) {
+    return 0;
+  }
+
+  std::uint64_t top = top_.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  Index bot = bot_.load(std::memory_order_acquire);
+
+  auto distance = distance_(bot, index_(top));
+  if (distance <= 0) {
+    return 0;
+  }
+
+  size_t count = dest.reserve_(std::min(max, static_cast<size_t>(distance + 1) / 2));
+  if (count == 0) {
+    return 0;
+  }
+
+  // Copy the boxes past dest's bottom first, they only become visible to dest's thieves once the claim succeeded.
+  // They have to be read before the CAS anyway, the owner may reuse the slots as soon as top moves.
+  Index dest_bot = dest.bot_.load(std::memory_order_relaxed);
+  for (size_t i = 0; i < count; ++i) {
+    dest.array_.put(dest_bot + i, array_.get(index_(top) + i, std::memory_order_relaxed), std::memory_order_relaxed);
+  }
+
+  if (!top_.compare_exchange_strong(top, pack_(index_(top) + count, tag_(top)), std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    return 0;
+  }
+
+  dest_bot += count;
+  dest.bot_.store(dest_bot, std::memory_order_release);
+  if (distance_(dest_bot, dest.bot_high_) > 0) {
+    dest.bot_high_ = dest_bot;
+  }
+
+  return count;
+}
+
+template <typename T>
+size_t StealingWorkQueue<T>::reserve_(size_t count) {
+  Index bot = bot_.load(std::memory_order_relaxed);
+  Index top = index_(top_.load(std::memory_order_acquire));
+
+  // queue is full, need to resize. Thieves keep reading the retired ring safely.
+  auto used = static_cast<size_t>(distance_(bot, top));
+  while (used + count > array_.capacity() && array_.can_grow()) {
+    // Slots are addressed modulo the capacity, which divides 2^32, so the copy may run past the wrap of Index
+    array_.grow(size_t{top} + used, top);
+  }
+
+  return std::min(count, array_.capacity() - used);
+}
+
+template <typename T>
+std::optional<T> StealingWorkQueue<T>::take_(T* item) {
+  if (item == nullptr) {
+    return std::nullopt;
   }
 
+  std::optional<T> ret{std::move(*item)};
+  delete item;
   return ret;
 }
 }  // namespace nyx::data_structure
@@ -0,0 +1,253 @@
+#ifndef DATA_STRUCTURE_TIMING_WHEEL_HPP
+#define DATA_STRUCTURE_TIMING_WHEEL_HPP
+
+// Hierarchical timing wheel with O(1) schedule and cancel.
+//
+// Time is counted in ticks. Every level has 64 slots and each slot of level l spans 64^l ticks. A timer goes
+// to the level of the highest 6 bit group in which its expiry differs from the current tick, so it waits in a
+// coarse slot while it is far away and is cascaded into finer levels as the current tick reaches its slot.
+// Timers further away than the top level can span wait there for whole revolutions. Each level keeps a
+// 64 bit occupancy mask, which makes finding the next tick with work a few bit scans regardless of how many
+// empty ticks lie in between.
+// Timers are intrusive nodes recycled through a free list. TimerId carries a generation, cancelling a timer
+// that already fired or was cancelled is a no-op.
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "src/utils/include/bitwise.hpp"
+
+namespace nyx::data_structure {
+
+template <typename T, std::size_t Levels = 6>
+class TimingWheel {
+  static_assert(Levels >= 2 && Levels <= 10, "Levels of 6 bits must fit in a 64 bit tick");
+
+ public:
+  using Tick = std::uint64_t;
+  static constexpr Tick kNever = std::numeric_limits<Tick>::max();
+
+ private:
+  static constexpr std::size_t kSlotBits = 6;
+  static constexpr std::size_t kSlots = std::size_t{1} << kSlotBits;
+
+  struct Node {
+    Node* prev{nullptr};
+    Node* next{nullptr};
+    Tick expiry{0};
+    std::uint64_t generation{0};
+    std::uint8_t level{0};
+    std::uint8_t slot{0};
+    bool active{false};
+    T value;
+  };
+
+ public:
+  struct TimerId {
+    Node* node{nullptr};
+    std::uint64_t generation{0};
+  };
+
+ private:
+  Tick now_;
+  std::size_t size_{0};
+  Node* slots_[Levels][kSlots]{};
+  std::size_t masks_[Levels]{};
+
+  // Stable addresses, nodes are never freed before the wheel
+  std::deque<Node> nodes_;
+  std::vector<Node*> free_;
+
+ public:
+  explicit TimingWheel(Tick now = 0) : now_(now) {}
+
+  TimingWheel(const TimingWheel&) = delete;
+  TimingWheel& operator=(const TimingWheel&) = delete;
+
+  // Ticks up to now() have been processed.
+  Tick now() const noexcept { return now_; }
+  std::size_t size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  // Expires at now() + delay, a delay of 0 counts as 1: the current tick is already processed.
+  TimerId schedule(Tick delay, T value);
+  // Returns false when the timer already fired or was cancelled.
+  bool cancel(TimerId id) noexcept;
+
+  // Earliest tick at which advance() has something to do, a cascade or an expiry. kNever when empty.
+  Tick next_tick() const noexcept;
+
+  // Processes every tick up to target and calls on_expire(T&&) for each timer that expires, in expiry order
+  // (timers sharing a tick in any order). on_expire may schedule and cancel timers. Returns the number of
+  // expired timers.
+  template <typename OnExpire>
+  std::size_t advance(Tick target, OnExpire&& on_expire);
+
+ private:
+  void link_(Node*, Tick now) noexcept;
+  void unlink_(Node*) noexcept;
+  void release_(Node*) noexcept;
+  // Moves the timers of a slot down to where they belong now
+  void cascade_(std::size_t level, std::size_t slot) noexcept;
+
+  static std::size_t slot_of_(Tick tick, std::size_t level) noexcept { return (tick >> (level * kSlotBits)) & (kSlots - 1); }
+};
+
+template <typename T, std::size_t Levels>
+typename TimingWheel<T, Levels>::TimerId TimingWheel<T, Levels>::schedule(Tick delay, T value) {
+  Node* node;
+  if (!free_.empty()) {
+    node = free_.back();
+    free_.pop_back();
+  } else {
+    node = &nodes_.emplace_back();
+  }
+
+  node->expiry = now_ + (delay == 0 ? 1 : delay);
+  node->value = std::move(value);
+  node->active = true;
+  link_(node, now_);
+  ++size_;
+
+  return TimerId{node, node->generation};
+}
+
+template <typename T, std::size_t Levels>
+bool TimingWheel<T, Levels>::cancel(TimerId id) noexcept {
+  if (id.node == nullptr || id.node->generation != id.generation || !id.node->active) {
+    return false;
+  }
+
+  unlink_(id.node);
+  release_(id.node);
+  return true;
+}
+
+template <typename T, std::size_t Levels>
+typename TimingWheel<T, Levels>::Tick TimingWheel<T, Levels>::next_tick() const noexcept {
+  if (size_ == 0) {
+    return kNever;
+  }
+
+  Tick best = kNever;
+  for (std::size_t level = 0; level < Levels; ++level) {
+    if (masks_[level] == 0) {
+      continue;
+    }
+
+    auto shift = level * kSlotBits;
+    auto position = slot_of_(now_, level);
+    auto window = (now_ >> (shift + kSlotBits)) << (shift + kSlotBits);
+    // Below the top level, occupied slots always lie ahead of the current position
+    auto ahead = position + 1 < kSlots ? masks_[level] & (~std::size_t{0} << (position + 1)) : 0;
+    Tick tick;
+    if (ahead != 0) {
+      tick = window + (static_cast<Tick>(utils::bitwise::ctz(ahead)) << shift);
+    } else {
+      // Only the top level wraps around, into its next revolution
+      assert(level == Levels - 1);
+      tick = window + (Tick{1} << (shift + kSlotBits)) + (static_cast<Tick>(utils::bitwise::ctz(masks_[level])) << shift);
+    }
+    best = tick < best ? tick : best;
+  }
+  return best;
+}
+
+template <typename T, std::size_t Levels>
+template <typename OnExpire>
+std::size_t TimingWheel<T, Levels>::advance(Tick target, OnExpire&& on_expire) {
+  std::size_t expired = 0;
+  while (true) {
+    auto tick = next_tick();
+    if (tick > target) {
+      break;
+    }
+    now_ = tick;
+
+    for (std::size_t level = Levels - 1; level > 0; --level) {
+      if ((tick & ((Tick{1} << (level * kSlotBits)) - 1)) == 0) {
+        cascade_(level, slot_of_(tick, level));
+      }
+    }
+
+    // Popped one by one, on_expire may cancel timers of the same slot
+    auto slot = slot_of_(tick, 0);
+    while (auto* node = slots_[0][slot]) {
+      assert(node->expiry == tick);
+      unlink_(node);
+      T value = std::move(node->value);
+      release_(node);
+      ++expired;
+      on_expire(std::move(value));
+    }
+  }
+
+  if (target > now_) {
+    now_ = target;
+  }
+  return expired;
+}
+
+template <typename T, std::size_t Levels>
+void TimingWheel<T, Levels>::link_(Node* node, Tick now) noexcept {
+  std::size_t level = 0;
+  if (auto diff = node->expiry ^ now; diff != 0) {
+    level = static_cast<std::size_t>(utils::bitwise::lmb(diff)) / kSlotBits;
+    level = level < Levels ? level : Levels - 1;
+  }
+  auto slot = slot_of_(node->expiry, level);
+
+  node->level = static_cast<std::uint8_t>(level);
+  node->slot = static_cast<std::uint8_t>(slot);
+  node->prev = nullptr;
+  node->next = slots_[level][slot];
+  if (node->next != nullptr) {
+    node->next->prev = node;
+  }
+  slots_[level][slot] = node;
+  utils::bitwise::turn_on_bit(masks_[level], static_cast<std::uint8_t>(slot));
+}
+
+template <typename T, std::size_t Levels>
+void TimingWheel<T, Levels>::unlink_(Node* node) noexcept {
+  auto& head = slots_[node->level][node->slot];
+  if (node->prev != nullptr) {
+    node->prev->next = node->next;
+  } else {
+    head = node->next;
+  }
+  if (node->next != nullptr) {
+    node->next->prev = node->prev;
+  }
+  if (head == nullptr) {
+    utils::bitwise::turn_off_bit(masks_[node->level], node->slot);
+  }
+}
+
+template <typename T, std::size_t Levels>
+void TimingWheel<T, Levels>::release_(Node* node) noexcept {
+  node->active = false;
+  ++node->generation;
+  node->value = T{};
+  free_.push_back(node);
+  --size_;
+}
+
+template <typename T, std::size_t Levels>
+void TimingWheel<T, Levels>::cascade_(std::size_t level, std::size_t slot) noexcept {
+  auto* node = std::exchange(slots_[level][slot], nullptr);
+  utils::bitwise::turn_off_bit(masks_[level], static_cast<std::uint8_t>(slot));
+  while (node != nullptr) {
+    auto* next = node->next;
+    link_(node, now_);
+    node = next;
+  }
+}
+}  // namespace nyx::data_structure
+
+#endif  // !DATA_STRUCTURE_TIMING_WHEEL_HPP
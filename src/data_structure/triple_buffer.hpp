@@ -0,0 +1,89 @@
+#ifndef DATA_STRUCTURE_TRIPLE_BUFFER_HPP
+#define DATA_STRUCTURE_TRIPLE_BUFFER_HPP
+
+// Wait-free single producer, single consumer channel that only keeps the newest value.
+//
+// Three slots rotate between the producer, the consumer and a shared back slot. The producer fills its slot
+// and swaps it with the back slot, the consumer swaps its slot with the back slot when the back slot holds a
+// value it has not seen yet. Each side does one atomic exchange and never waits for the other, intermediate
+// values the consumer did not pick up in time are simply overwritten.
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+#include "src/common/include/define.hpp"
+
+namespace nyx::data_structure {
+
+using namespace common::define;
+
+template <typename T>
+class TripleBuffer {
+  static constexpr std::uint8_t kIndexMask = 0b011;
+  // Set on the back slot by the producer, cleared by the consumer
+  static constexpr std::uint8_t kFresh = 0b100;
+
+  struct alignas(hardware_constructive_interference_size) Slot {
+    T value;
+  };
+
+  Slot slots_[3];
+  // Index of the back slot, plus kFresh
+  alignas(hardware_constructive_interference_size) std::atomic<std::uint8_t> back_{0};
+  // Producer only
+  alignas(hardware_constructive_interference_size) std::uint8_t write_index_{1};
+  // Consumer only
+  alignas(hardware_constructive_interference_size) std::uint8_t read_index_{2};
+
+  char padding_[kPaddingSize];
+
+ public:
+  explicit TripleBuffer(const T& initial = T{}) : slots_{{initial}, {initial}, {initial}} {}
+
+  TripleBuffer(const TripleBuffer&) = delete;
+  TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+  // Producer side: fill write_buffer() in place then publish() it, or write() a whole value.
+  // After publish() the write buffer is a different slot holding an older value.
+  T& write_buffer() noexcept { return slots_[write_index_].value; }
+  void publish() noexcept;
+  template <typename U>
+  void write(U&& value) {
+    write_buffer() = std::forward<U>(value);
+    publish();
+  }
+
+  // Consumer side: update() picks up the newest published value if there is one and returns whether it did,
+  // read_buffer() is the value picked up last. read() does both.
+  bool update() noexcept;
+  const T& read_buffer() const noexcept { return slots_[read_index_].value; }
+  const T& read() noexcept {
+    update();
+    return read_buffer();
+  }
+
+  // Consumer side, true when update() would pick up a new value.
+  bool has_update() const noexcept { return back_.load(std::memory_order_relaxed) & kFresh; }
+};
+
+template <typename T>
+void TripleBuffer<T>::publish() noexcept {
+  // Release our writes, acquire the consumer's last reads of the slot we take over
+  auto back = back_.exchange(write_index_ | kFresh, std::memory_order_acq_rel);
+  write_index_ = back & kIndexMask;
+}
+
+template <typename T>
+bool TripleBuffer<T>::update() noexcept {
+  if (!has_update()) {
+    return false;
+  }
+
+  auto back = back_.exchange(read_index_, std::memory_order_acq_rel);
+  read_index_ = back & kIndexMask;
+  return true;
+}
+}  // namespace nyx::data_structure
+
+#endif  // !DATA_STRUCTURE_TRIPLE_BUFFER_HPP
@@ -10,7 +10,8 @@
 namespace nyx {
 namespace data_structure {
 
-template <typename T, typename Hash = std::hash<T>>
+// Map is the container from element to its list node, FlatHashMap is a drop-in replacement for the default.
+template <typename T, typename Hash = std::hash<T>, template <typename...> class Map = std::unordered_map>
 class UniqueList {
  public:
   enum REPLACE_RESULT {
@@ -21,7 +22,7 @@ class UniqueList {
 
  private:
   std::list<T> list_;
-  std::unordered_map<T, typename std::list<T>::iterator, Hash> map_;
+  Map<T, typename std::list<T>::iterator, Hash> map_;
 
  public:
   UniqueList() {}
@@ -46,15 +47,15 @@ class UniqueList {
   std::optional<typename std::list<T>::const_iterator> try_get_node(const T&) const;
 };
 
-template <typename T, typename Hash>
-UniqueList<T, Hash>::UniqueList(const std::vector<T>& other) {
+template <typename T, typename Hash, template <typename...> class Map>
+UniqueList<T, Hash, Map>::UniqueList(const std::vector<T>& other) {
   for (const auto& it : other) {
     push_back(it);
   }
 }
 
-template <typename T, typename Hash>
-bool UniqueList<T, Hash>::push_back(const T& value) {
+template <typename T, typename Hash, template <typename...> class Map>
+bool UniqueList<T, Hash, Map>::push_back(const T& value) {
   if (map_.find(value) != map_.end()) {
     return false;
   }
@@ -64,8 +65,8 @@ bool UniqueList<T, Hash>::push_back(const T& value) {
   return true;
 }
 
-template <typename T, typename Hash>
-bool UniqueList<T, Hash>::pop_back(T& out) {
+template <typename T, typename Hash, template <typename...> class Map>
+bool UniqueList<T, Hash, Map>::pop_back(T& out) {
   if (list_.empty()) {
     return false;
   }
@@ -77,8 +78,8 @@ bool UniqueList<T, Hash>::pop_back(T& out) {
   return true;
 }
 
-template <typename T, typename Hash>
-bool UniqueList<T, Hash>::pop(const T& key) {
+template <typename T, typename Hash, template <typename...> class Map>
+bool UniqueList<T, Hash, Map>::pop(const T& key) {
   if (contain(key)) {
     list_.erase(map_[key]);
     map_.erase(key);
@@ -88,13 +89,13 @@ bool UniqueList<T, Hash>::pop(const T& key) {
   return false;
 }
 
-template <typename T, typename Hash>
-bool UniqueList<T, Hash>::contain(const T& key) const {
+template <typename T, typename Hash, template <typename...> class Map>
+bool UniqueList<T, Hash, Map>::contain(const T& key) const {
   return map_.find(key) != map_.end();
 }
 
-template <typename T, typename Hash>
-UniqueList<T, Hash>::REPLACE_RESULT UniqueList<T, Hash>::replace(const T& value, const T& replace_value) {
+template <typename T, typename Hash, template <typename...> class Map>
+UniqueList<T, Hash, Map>::REPLACE_RESULT UniqueList<T, Hash, Map>::replace(const T& value, const T& replace_value) {
   if (!contain(value)) {
     return KEY_NOT_FOUND;
   }
@@ -113,8 +114,8 @@ UniqueList<T, Hash>::REPLACE_RESULT UniqueList<T, Hash>::replace(const T& value,
   return SUCCESS;
 }
 
-template <typename T, typename Hash>
-std::optional<typename std::list<T>::const_iterator> UniqueList<T, Hash>::try_get_node(const T& key) const {
+template <typename T, typename Hash, template <typename...> class Map>
+std::optional<typename std::list<T>::const_iterator> UniqueList<T, Hash, Map>::try_get_node(const T& key) const {
   if (contain(key)) {
     return map_.at(key);
   }
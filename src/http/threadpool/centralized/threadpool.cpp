@@ -11,6 +11,9 @@ namespace centralized {
 CentralizedThreadpool::CentralizedThreadpool(Config&& config) : ICentralizedThreadpool(std::forward<Config>(config)) {}
 
 CentralizedThreadpool::~CentralizedThreadpool() {
+  // No timer may enqueue once the workers are gone
+  timer_.stop();
+
   {
     std::unique_lock<std::mutex> lock{task_queue_mutex_};
     is_running_ = false;
@@ -32,6 +35,18 @@ void CentralizedThreadpool::initialize_() {
   }
 }
 
+bool CentralizedThreadpool::enqueue_(Task&& task) {
+  {
+    std::scoped_lock<std::mutex> lock{task_queue_mutex_};
+    if (!task_queue_.push(std::move(task))) {
+      return false;
+    }
+  }
+  task_queue_conditional_variable_.notify_one();
+
+  return true;
+}
+
 std::shared_ptr<CentralizedThreadpool> CentralizedThreadpool::create(Config&& config) {
   auto pool = std::shared_ptr<CentralizedThreadpool>(new CentralizedThreadpool(std::move(config)));
   pool->initialize_();
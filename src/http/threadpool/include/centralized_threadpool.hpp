@@ -6,6 +6,7 @@
  * It includes the base class for the threadpool, the main threadpool class, and the worker class.
  */
 
+#include <chrono>
 #include <future>
 #include <memory>
 #include <thread>
@@ -13,6 +14,8 @@
 
 #include "src/data_structure/scsp_lockfree_queue.hpp"
 #include "src/http/threadpool/include/base.hpp"
+#include "src/http/threadpool/include/pooled_task.hpp"
+#include "src/http/threadpool/include/timer.hpp"
 
 namespace nyx {
 namespace threadpool {
@@ -50,12 +53,21 @@ class ICentralizedThreadpool : public IThreadpool, public std::enable_shared_fro
  */
 class CentralizedThreadpool : public ICentralizedThreadpool {
   std::vector<std::thread> workers_;
+  // Hands delayed and periodic tasks to the task queue when they are due
+  Timer timer_;
 
   /**
    * @brief Initializes the worker threads.
    */
   void initialize_() override;
 
+  /**
+   * @brief Pushes a task to the task queue and wakes up a worker.
+   *
+   * @return bool False when the task queue is full, task is left untouched.
+   */
+  bool enqueue_(Task&& task);
+
  public:
   CentralizedThreadpool() = delete;
 
@@ -82,6 +94,8 @@ class CentralizedThreadpool : public ICentralizedThreadpool {
   /**
    * @brief Submits a task to the threadpool for execution.
    *
+   * The task and the state of its future come from the slab pool, no malloc once the pool is warm.
+   *
    * @tparam F The type of the function to execute.
    * @tparam Args The types of the arguments to pass to the function.
    * @param f The function to execute.
@@ -90,6 +104,37 @@ class CentralizedThreadpool : public ICentralizedThreadpool {
    */
   template <typename F, typename... Args>
   auto submit_task(F&& f, Args&&... args) -> std::future<decltype(f(args...))>;
+
+  /**
+   * @brief Submits a task to the threadpool once delay has elapsed.
+   *
+   * @param delay Time to wait before the task is queued, with millisecond resolution.
+   * @param f The function to execute.
+   * @param args The arguments to pass to the function.
+   * @return std::future<decltype(f(args...))> Future representing the result of the task.
+   */
+  template <typename F, typename... Args>
+  auto schedule_after(std::chrono::milliseconds delay, F&& f, Args&&... args) -> std::future<decltype(f(args...))>;
+
+  /**
+   * @brief Submits a task to the threadpool every period, starting one period from now.
+   *
+   * Each run is a separate task on the pool, runs of a slow task may overlap.
+   *
+   * @param period Time between two submissions, with millisecond resolution.
+   * @param f The function to execute, its result is discarded.
+   * @param args The arguments to pass to the function.
+   * @return Timer::Id Identifier to cancel the periodic task with.
+   */
+  template <typename F, typename... Args>
+  Timer::Id schedule_every(std::chrono::milliseconds period, F&& f, Args&&... args);
+
+  /**
+   * @brief Cancels a task scheduled with schedule_every. Runs already submitted to the pool still execute.
+   *
+   * @return bool False when the id is unknown or already cancelled.
+   */
+  bool cancel(Timer::Id id) { return timer_.cancel(id); }
 };
 
 /**
@@ -120,20 +165,36 @@ template <typename F, typename... Args>
 auto CentralizedThreadpool::submit_task(F&& f, Args&&... args) -> std::future<decltype(f(args...))> {
   using return_type = decltype(f(args...));
 
+  auto* task = make_pooled_task<return_type>(std::forward<F>(f), std::forward<Args>(args)...);
+  auto result = task->get_future();
+
+  if (!enqueue_(task->task())) {
+    task->discard();
+  }
+
+  return result;
+}
+
+template <typename F, typename... Args>
+auto CentralizedThreadpool::schedule_after(std::chrono::milliseconds delay, F&& f, Args&&... args) -> std::future<decltype(f(args...))> {
+  using return_type = decltype(f(args...));
+
   std::packaged_task<return_type()> task(std::bind(std::forward<F>(f), std::forward<Args>(args)...));
   auto task_ptr = std::make_shared<std::packaged_task<return_type()>>(std::move(task));
   auto result = task_ptr->get_future();
-  auto wrapper = [task_ptr]() { (*task_ptr)(); };
 
-  {
-    std::scoped_lock<std::mutex> lock{task_queue_mutex_};
-    task_queue_.push(std::move(wrapper));
-  }
-  task_queue_conditional_variable_.notify_one();
+  timer_.schedule_after(delay, [this, task_ptr]() { enqueue_([task_ptr]() { (*task_ptr)(); }); });
 
   return result;
 }
 
+template <typename F, typename... Args>
+Timer::Id CentralizedThreadpool::schedule_every(std::chrono::milliseconds period, F&& f, Args&&... args) {
+  Task task = std::bind(std::forward<F>(f), std::forward<Args>(args)...);
+
+  return timer_.schedule_every(period, [this, task = std::move(task)]() { enqueue_(Task(task)); });
+}
+
 }  // namespace centralized
 }  // namespace threadpool
 }  // namespace nyx
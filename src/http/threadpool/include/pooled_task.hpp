@@ -0,0 +1,109 @@
+/**
+ * @file pooled_task.hpp
+ * @brief Submitted task whose callable and shared state live in the slab pool
+ *
+ * A packaged_task behind a shared_ptr behind a std::function costs three heap allocations per task. Here the
+ * bound callable and the promise share one block of the slab pool, the promise allocates its shared state
+ * from the pool too, and the Task only captures a pointer, which std::function stores inline.
+ */
+
+#ifndef THREADPOOL_POOLED_TASK_HPP
+#define THREADPOOL_POOLED_TASK_HPP
+
+#include <exception>
+#include <future>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "src/http/threadpool/include/base.hpp"
+#include "src/memory/include/slab_pool.hpp"
+
+namespace nyx {
+namespace threadpool {
+
+/**
+ * @class PooledTask
+ * @brief One submitted call of Fn, fulfilling a std::future<R>.
+ *
+ * The object owns itself: it is freed by run(), or by discard() when it is dropped without running.
+ */
+template <typename R, typename Fn>
+class PooledTask {
+  using Allocator = memory::SlabAllocator<PooledTask>;
+
+  Fn fn_;
+  std::promise<R> promise_;
+
+  explicit PooledTask(Fn&& fn) : fn_(std::move(fn)), promise_(std::allocator_arg, memory::SlabAllocator<char>{}) {}
+
+  void destroy_() noexcept {
+    Allocator allocator;
+    this->~PooledTask();
+    allocator.deallocate(this, 1);
+  }
+
+ public:
+  PooledTask(const PooledTask&) = delete;
+  PooledTask& operator=(const PooledTask&) = delete;
+
+  /**
+   * @brief Allocates a task from the slab pool.
+   */
+  static PooledTask* create(Fn&& fn) {
+    Allocator allocator;
+    auto* task = allocator.allocate(1);
+    try {
+      return new (task) PooledTask(std::move(fn));
+    } catch (...) {
+      allocator.deallocate(task, 1);
+      throw;
+    }
+  }
+
+  std::future<R> get_future() { return promise_.get_future(); }
+
+  /**
+   * @brief Calls fn, fulfils the future with its result or exception, then frees the task.
+   */
+  void run() noexcept {
+    try {
+      if constexpr (std::is_void_v<R>) {
+        fn_();
+        promise_.set_value();
+      } else {
+        promise_.set_value(fn_());
+      }
+    } catch (...) {
+      promise_.set_exception(std::current_exception());
+    }
+    destroy_();
+  }
+
+  /**
+   * @brief Frees the task without running it, its future reports std::future_errc::broken_promise.
+   */
+  void discard() noexcept { destroy_(); }
+
+  /**
+   * @brief Task running this object, to be called exactly once.
+   */
+  Task task() {
+    return [this]() { run(); };
+  }
+};
+
+/**
+ * @brief Binds f to args into a PooledTask returning R.
+ */
+template <typename R, typename F, typename... Args>
+auto make_pooled_task(F&& f, Args&&... args) {
+  using Fn = decltype(std::bind(std::forward<F>(f), std::forward<Args>(args)...));
+  return PooledTask<R, Fn>::create(std::bind(std::forward<F>(f), std::forward<Args>(args)...));
+}
+
+}  // namespace threadpool
+}  // namespace nyx
+
+#endif  // !THREADPOOL_POOLED_TASK_HPP
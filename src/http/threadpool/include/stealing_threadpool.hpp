@@ -1,8 +1,10 @@
+#include <chrono>
 #include <future>
 #include <memory>
 
 #include "src/data_structure/scsp_lockfree_queue.hpp"
 #include "src/http/threadpool/include/base.hpp"
+#include "src/http/threadpool/include/pooled_task.hpp"
 
 namespace nyx {
 namespace threadpool {
@@ -43,6 +45,8 @@ class StealingThreadpool : public IStealingThreadpool {
   /**
    * @brief Submits a task to the threadpool for execution.
    *
+   * The task and the state of its future come from the slab pool, no malloc once the pool is warm.
+   *
    * @tparam F The type of the function to execute.
    * @tparam Args The types of the arguments to pass to the function.
    * @param f The function to execute.
@@ -51,6 +55,13 @@ class StealingThreadpool : public IStealingThreadpool {
    */
   template <typename F, typename... Args>
   auto submit_task(F&& f, Args&&... args) -> std::future<decltype(f(args...))>;
+
+  // Delayed and periodic tasks would go through submit_task, which is still a stub that discards every task.
+  // Disabled until the workers own their queues, use CentralizedThreadpool::schedule_after/schedule_every.
+  template <typename F, typename... Args>
+  auto schedule_after(std::chrono::milliseconds delay, F&& f, Args&&... args) -> std::future<decltype(f(args...))> = delete;
+  template <typename F, typename... Args>
+  void schedule_every(std::chrono::milliseconds period, F&& f, Args&&... args) = delete;
 };
 
 class Worker : public IWorker<IStealingThreadpool> {
@@ -68,12 +79,12 @@ template <typename F, typename... Args>
 auto StealingThreadpool::submit_task(F&& f, Args&&... args) -> std::future<decltype(f(args...))> {
   using return_type = decltype(f(args...));
 
-  std::packaged_task<return_type()> task(std::bind(std::forward<F>(f), std::forward<Args>(args)...));
-  auto task_ptr = std::make_shared<std::packaged_task<return_type()>>(std::move(task));
-  auto result = task_ptr->get_future();
-  auto wrapper = [task_ptr]() { (*task_ptr)(); };
+  auto* task = make_pooled_task<return_type>(std::forward<F>(f), std::forward<Args>(args)...);
+  auto result = task->get_future();
 
   // { std::scoped_lock<std::mutex> lock{global_task_queue_mutex_enqueue_}; }
+  // Not enqueued until the workers have their queues, the future reports broken_promise
+  task->discard();
 
   return result;
 }
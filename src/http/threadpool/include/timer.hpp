@@ -0,0 +1,123 @@
+/**
+ * @file timer.hpp
+ * @brief Timer thread for delayed and periodic tasks
+ *
+ * A single thread sleeps until the next timer of a hierarchical timing wheel is due and runs the callbacks
+ * that expired. Scheduling and cancelling are O(1), the thread wakes up only when a timer expires or the
+ * wheel has to cascade, never once per tick.
+ */
+
+#ifndef THREADPOOL_TIMER_HPP
+#define THREADPOOL_TIMER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include "src/data_structure/timing_wheel.hpp"
+#include "src/http/threadpool/include/base.hpp"
+
+namespace nyx {
+namespace threadpool {
+
+/**
+ * @class Timer
+ * @brief Runs tasks after a delay or periodically, on its own thread.
+ *
+ * The resolution is one millisecond. Callbacks run on the timer thread and should only hand the work off,
+ * a slow callback delays every other timer.
+ */
+class Timer {
+ public:
+  using Id = std::uint64_t;
+  using Clock = std::chrono::steady_clock;
+
+ private:
+  using Wheel = data_structure::TimingWheel<Id>;
+
+  struct Record {
+    Wheel::TimerId timer;
+    // Zero for one-shot timers
+    std::chrono::milliseconds period;
+    // Shared so the timer thread can run it unlocked while it is cancelled
+    std::shared_ptr<Task> task;
+  };
+
+  std::mutex mutex_;
+  std::condition_variable conditional_variable_;
+  Clock::time_point start_;
+  Wheel wheel_;
+  std::unordered_map<Id, Record> records_;
+  Id next_id_{1};
+  bool stop_{false};
+  std::thread thread_;
+
+  /**
+   * @brief Main loop of the timer thread.
+   */
+  void run_();
+
+  /**
+   * @brief Adds a timer, requires mutex_ and starts the timer thread on first use.
+   */
+  Id schedule_(std::chrono::milliseconds delay, std::chrono::milliseconds period, Task&& task);
+
+  /**
+   * @brief Milliseconds elapsed since construction, the wheel's tick.
+   */
+  Wheel::Tick elapsed_() const;
+
+ public:
+  Timer();
+
+  /**
+   * @brief Stops the timer thread, pending timers are dropped.
+   */
+  ~Timer();
+
+  Timer(const Timer&) = delete;
+  Timer& operator=(const Timer&) = delete;
+
+  /**
+   * @brief Runs task once after delay.
+   *
+   * @return Id Identifier to cancel the timer with.
+   */
+  Id schedule_after(std::chrono::milliseconds delay, Task&& task);
+
+  /**
+   * @brief Runs task every period, starting one period from now.
+   *
+   * Expiries are computed from the previous expiry, not from when the callback ran, so a periodic timer does
+   * not drift. A timer thread that fell behind catches up by running the missed expiries back to back.
+   *
+   * @return Id Identifier to cancel the timer with.
+   */
+  Id schedule_every(std::chrono::milliseconds period, Task&& task);
+
+  /**
+   * @brief Cancels a timer. A callback that is already running is not interrupted.
+   *
+   * @return bool False when the timer already fired or was cancelled.
+   */
+  bool cancel(Id id);
+
+  /**
+   * @brief Stops and joins the timer thread, pending timers are dropped. Idempotent.
+   */
+  void stop();
+
+  /**
+   * @brief Number of timers waiting to fire.
+   */
+  std::size_t pending();
+};
+
+}  // namespace threadpool
+}  // namespace nyx
+
+#endif  // !THREADPOOL_TIMER_HPP
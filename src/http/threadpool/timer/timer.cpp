@@ -0,0 +1,120 @@
+#include "src/http/threadpool/include/timer.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace nyx {
+namespace threadpool {
+Timer::Timer() : start_(Clock::now()) {}
+
+Timer::~Timer() { stop(); }
+
+Timer::Id Timer::schedule_after(std::chrono::milliseconds delay, Task&& task) {
+  return schedule_(delay, std::chrono::milliseconds::zero(), std::move(task));
+}
+
+Timer::Id Timer::schedule_every(std::chrono::milliseconds period, Task&& task) {
+  // A period of 0 would fire on every tick
+  return schedule_(period, period > std::chrono::milliseconds::zero() ? period : std::chrono::milliseconds(1), std::move(task));
+}
+
+Timer::Id Timer::schedule_(std::chrono::milliseconds delay, std::chrono::milliseconds period, Task&& task) {
+  Id id;
+  {
+    std::scoped_lock<std::mutex> lock{mutex_};
+    if (stop_) {
+      return 0;
+    }
+
+    id = next_id_++;
+    // The wheel only moves while the timer thread is awake, the delay counts from the real current tick. One
+    // more tick for the part of the current one that already elapsed, a timer never fires early.
+    auto ticks = elapsed_() - wheel_.now() + 1 + static_cast<Wheel::Tick>(delay > std::chrono::milliseconds::zero() ? delay.count() : 0);
+    records_.emplace(id, Record{wheel_.schedule(ticks, id), period, std::make_shared<Task>(std::move(task))});
+
+    if (!thread_.joinable()) {
+      thread_ = std::thread(&Timer::run_, this);
+    }
+  }
+  conditional_variable_.notify_one();
+
+  return id;
+}
+
+bool Timer::cancel(Id id) {
+  std::scoped_lock<std::mutex> lock{mutex_};
+  auto it = records_.find(id);
+  if (it == records_.end()) {
+    return false;
+  }
+
+  wheel_.cancel(it->second.timer);
+  records_.erase(it);
+  return true;
+}
+
+void Timer::stop() {
+  {
+    std::scoped_lock<std::mutex> lock{mutex_};
+    stop_ = true;
+  }
+  conditional_variable_.notify_one();
+
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+
+  std::scoped_lock<std::mutex> lock{mutex_};
+  records_.clear();
+}
+
+std::size_t Timer::pending() {
+  std::scoped_lock<std::mutex> lock{mutex_};
+  return records_.size();
+}
+
+Timer::Wheel::Tick Timer::elapsed_() const {
+  return static_cast<Wheel::Tick>(std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start_).count());
+}
+
+void Timer::run_() {
+  std::vector<std::shared_ptr<Task>> expired;
+  std::unique_lock<std::mutex> lock{mutex_};
+
+  while (!stop_) {
+    auto next = wheel_.next_tick();
+    if (next == Wheel::kNever) {
+      conditional_variable_.wait(lock);
+    } else if (next > elapsed_()) {
+      // Also woken up by schedule_, the new timer may be due earlier
+      conditional_variable_.wait_until(lock, start_ + std::chrono::milliseconds(next));
+    }
+    if (stop_) {
+      break;
+    }
+
+    wheel_.advance(elapsed_(), [this, &expired](Id id) {
+      auto it = records_.find(id);
+      expired.push_back(it->second.task);
+      if (it->second.period > std::chrono::milliseconds::zero()) {
+        it->second.timer = wheel_.schedule(static_cast<Wheel::Tick>(it->second.period.count()), id);
+      } else {
+        records_.erase(it);
+      }
+    });
+
+    if (expired.empty()) {
+      continue;
+    }
+
+    // Callbacks may schedule and cancel timers
+    lock.unlock();
+    for (auto& task : expired) {
+      (*task)();
+    }
+    expired.clear();
+    lock.lock();
+  }
+}
+}  // namespace threadpool
+}  // namespace nyx
@@ -0,0 +1,127 @@
+#ifndef JOURNAL_JOURNAL_HPP
+#define JOURNAL_JOURNAL_HPP
+
+// Append-only persistent queue on memory-mapped segment files.
+//
+// The journal is one byte stream addressed by 64 bit offsets, cut into fixed-size segment files named after
+// their index. Records are length prefixed and 8 byte aligned; a record that does not fit in what is left of a
+// segment is preceded by a padding marker and starts the next one. Like ScspLockFreeQueue, one producer and
+// one consumer own a cursor each into the stream and publish it with a release store, so append and consume
+// are plain memory copies into the mapping.
+// Durability is asynchronous: a background thread msyncs what was appended, persists the consumer offset as a
+// checkpoint, maps the next segment ahead of the producer and deletes segments the consumer is done with.
+// Records survive a crash of the process as soon as they are appended (the page cache outlives it) and a
+// crash of the machine once flush() returned or the flusher caught up.
+//
+// On open the consumer resumes from the checkpoint, so records consumed after the last checkpoint are
+// delivered again.
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "src/common/include/define.hpp"
+
+namespace nyx::journal {
+struct Options {
+  // Rounded up to a multiple of the page size. Ignored when the directory already holds segments.
+  std::size_t segment_size = 64 << 20;
+  // How often the background thread syncs, checkpoints and rolls segments over.
+  std::chrono::milliseconds flush_interval{10};
+};
+
+class Journal {
+  struct Segment;
+
+  std::string directory_;
+  std::size_t segment_size_;
+  std::chrono::milliseconds flush_interval_;
+
+  // Mapped segments by index, only touched when a cursor crosses a segment boundary
+  std::mutex segments_mutex_;
+  std::map<std::uint64_t, std::shared_ptr<Segment>> segments_;
+
+  // Producer
+  alignas(common::define::hardware_constructive_interference_size) std::atomic<std::uint64_t> push_cursor_{0};
+  std::shared_ptr<Segment> push_segment_;
+  std::uint64_t reserved_cursor_{0};
+  std::uint32_t reserved_size_{0};
+
+  // Consumer
+  alignas(common::define::hardware_constructive_interference_size) std::atomic<std::uint64_t> pop_cursor_{0};
+  std::uint64_t cached_push_cursor_{0};
+  std::shared_ptr<Segment> pop_segment_;
+
+  // Background flusher
+  alignas(common::define::hardware_constructive_interference_size) std::atomic<std::uint64_t> durable_cursor_{0};
+  std::uint64_t checkpoint_cursor_{0};
+  std::mutex flush_mutex_;
+  std::mutex stop_mutex_;
+  std::condition_variable stop_cv_;
+  bool stop_{false};
+  std::thread flusher_;
+
+  Journal(std::string directory, std::size_t segment_size, std::chrono::milliseconds flush_interval);
+
+ public:
+  // Opens the journal stored in directory, creating the directory if needed. Returns nullptr with errno set
+  // on failure.
+  static std::unique_ptr<Journal> open(const std::string& directory, const Options& options = {});
+  // Stops the flusher after a last sync and checkpoint.
+  ~Journal();
+
+  Journal(const Journal&) = delete;
+  Journal& operator=(const Journal&) = delete;
+
+  std::size_t segment_size() const noexcept { return segment_size_; }
+  // Largest record append() accepts.
+  std::size_t max_record_size() const noexcept;
+
+  // Producer side: appends one record. Fails with EMSGSIZE when the record is larger than max_record_size(),
+  // or with the error of mapping a new segment.
+  bool append(std::string_view record);
+  // Zero-copy producer side: reserve() returns size bytes to fill (nullptr on failure), commit() publishes them.
+  char* reserve(std::size_t size);
+  void commit();
+
+  // Consumer side: front() is the oldest record not consumed yet, valid until consume().
+  std::optional<std::string_view> front();
+  void consume();
+  bool pop(std::string& record);
+
+  // Any thread: synchronously msyncs everything appended so far and checkpoints the consumer offset.
+  void flush();
+
+  // Stream offsets: end of the appended records, end of the synced ones, and the consumer position.
+  std::uint64_t appended() const noexcept { return push_cursor_.load(std::memory_order_acquire); }
+  std::uint64_t durable() const noexcept { return durable_cursor_.load(std::memory_order_acquire); }
+  std::uint64_t consumed() const noexcept { return pop_cursor_.load(std::memory_order_acquire); }
+
+ private:
+  std::string segment_path_(std::uint64_t index) const;
+  std::string checkpoint_path_() const { return directory_ + "/checkpoint"; }
+
+  // Maps segment index, creating its file when create is set. nullptr with errno set on failure.
+  std::shared_ptr<Segment> segment_(std::uint64_t index, bool create);
+  // Rebuilds both cursors from the checkpoint and the newest segment.
+  bool recover_();
+
+  void run_flusher_();
+  // Both require flush_mutex_
+  void sync_();
+  void checkpoint_();
+  // Maps the segment after the producer's one and unlinks those before the checkpoint
+  void roll_segments_();
+};
+}  // namespace nyx::journal
+
+#endif  // !JOURNAL_JOURNAL_HPP
@@ -0,0 +1,385 @@
+#include "include/journal.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <set>
+
+namespace nyx::journal {
+namespace {
+enum class Kind : std::uint32_t {
+  // Zeroed memory, nothing was appended here yet
+  kEnd = 0,
+  kRecord = 1,
+  // The rest of the segment is unused, the stream continues in the next segment
+  kPadding = 2,
+};
+
+struct RecordHeader {
+  std::uint32_t size;
+  Kind kind;
+};
+constexpr std::size_t kHeaderSize = sizeof(RecordHeader);
+constexpr std::size_t kAlignment = 8;
+static_assert(kHeaderSize % kAlignment == 0);
+
+constexpr std::size_t align_up(std::size_t size, std::size_t alignment) { return (size + alignment - 1) / alignment * alignment; }
+constexpr std::size_t record_span(std::size_t size) { return align_up(kHeaderSize + size, kAlignment); }
+
+RecordHeader* header_at(char* base, std::size_t offset) { return reinterpret_cast<RecordHeader*>(base + offset); }
+
+std::size_t page_size() {
+  static const auto size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+  return size;
+}
+
+constexpr std::string_view kSegmentSuffix = ".seg";
+}  // namespace
+
+struct Journal::Segment {
+  std::uint64_t index;
+  int fd;
+  char* base;
+  std::size_t size;
+
+  ~Segment() {
+    munmap(base, size);
+    close(fd);
+  }
+};
+
+Journal::Journal(std::string directory, std::size_t segment_size, std::chrono::milliseconds flush_interval)
+    : directory_(std::move(directory)), segment_size_(segment_size), flush_interval_(flush_interval) {}
+
+std::unique_ptr<Journal> Journal::open(const std::string& directory, const Options& options) {
+  if (mkdir(directory.c_str(), 0755) != 0 && errno != EEXIST) {
+    return nullptr;
+  }
+
+  auto segment_size = align_up(std::max<std::size_t>(options.segment_size, 1), page_size());
+  std::unique_ptr<Journal> journal(new Journal(directory, segment_size, options.flush_interval));
+  if (!journal->recover_()) {
+    return nullptr;
+  }
+
+  journal->flusher_ = std::thread(&Journal::run_flusher_, journal.get());
+  return journal;
+}
+
+Journal::~Journal() {
+  {
+    std::lock_guard<std::mutex> lock(stop_mutex_);
+    stop_ = true;
+  }
+  stop_cv_.notify_one();
+  if (flusher_.joinable()) {
+    flusher_.join();
+  }
+  flush();
+}
+
+std::size_t Journal::max_record_size() const noexcept { return std::min<std::size_t>(segment_size_ - kHeaderSize, UINT32_MAX); }
+
+bool Journal::append(std::string_view record) {
+  auto* payload = reserve(record.size());
+  if (payload == nullptr) {
+    return false;
+  }
+
+  std::memcpy(payload, record.data(), record.size());
+  commit();
+  return true;
+}
+
+char* Journal::reserve(std::size_t size) {
+  if (size > max_record_size()) {
+    errno = EMSGSIZE;
+    return nullptr;
+  }
+
+  auto push_cursor = push_cursor_.load(std::memory_order_relaxed);
+  auto locate = [this](std::uint64_t cursor) {
+    auto index = cursor / segment_size_;
+    if (push_segment_ == nullptr || push_segment_->index != index) {
+      push_segment_ = segment_(index, true);
+    }
+    return push_segment_ != nullptr;
+  };
+  if (!locate(push_cursor)) {
+    return nullptr;
+  }
+
+  auto offset = push_cursor % segment_size_;
+  if (segment_size_ - offset < record_span(size)) {
+    // Published together with the record, by commit()
+    *header_at(push_segment_->base, offset) = RecordHeader{static_cast<std::uint32_t>(segment_size_ - offset - kHeaderSize), Kind::kPadding};
+    push_cursor += segment_size_ - offset;
+    offset = 0;
+    if (!locate(push_cursor)) {
+      return nullptr;
+    }
+  }
+
+  reserved_cursor_ = push_cursor;
+  reserved_size_ = static_cast<std::uint32_t>(size);
+  return push_segment_->base + offset + kHeaderSize;
+}
+
+void Journal::commit() {
+  *header_at(push_segment_->base, reserved_cursor_ % segment_size_) = RecordHeader{reserved_size_, Kind::kRecord};
+  push_cursor_.store(reserved_cursor_ + record_span(reserved_size_), std::memory_order_release);
+}
+
+std::optional<std::string_view> Journal::front() {
+  while (true) {
+    auto pop_cursor = pop_cursor_.load(std::memory_order_relaxed);
+    if (pop_cursor == cached_push_cursor_) {
+      cached_push_cursor_ = push_cursor_.load(std::memory_order_acquire);
+      if (pop_cursor == cached_push_cursor_) {
+        return std::nullopt;
+      }
+    }
+
+    auto index = pop_cursor / segment_size_;
+    if (pop_segment_ == nullptr || pop_segment_->index != index) {
+      pop_segment_ = segment_(index, false);
+      if (pop_segment_ == nullptr) {
+        return std::nullopt;
+      }
+    }
+
+    auto offset = pop_cursor % segment_size_;
+    const auto* header = header_at(pop_segment_->base, offset);
+    if (header->kind == Kind::kPadding) {
+      pop_cursor_.store(pop_cursor + (segment_size_ - offset), std::memory_order_release);
+      continue;
+    }
+    return std::string_view(pop_segment_->base + offset + kHeaderSize, header->size);
+  }
+}
+
+void Journal::consume() {
+  auto pop_cursor = pop_cursor_.load(std::memory_order_relaxed);
+  const auto* header = header_at(pop_segment_->base, pop_cursor % segment_size_);
+  pop_cursor_.store(pop_cursor + record_span(header->size), std::memory_order_release);
+}
+
+bool Journal::pop(std::string& record) {
+  auto front = this->front();
+  if (!front.has_value()) {
+    return false;
+  }
+
+  record.assign(*front);
+  consume();
+  return true;
+}
+
+void Journal::flush() {
+  std::lock_guard<std::mutex> lock(flush_mutex_);
+  sync_();
+  checkpoint_();
+}
+
+std::string Journal::segment_path_(std::uint64_t index) const {
+  char name[32];
+  std::snprintf(name, sizeof(name), "%020llu", static_cast<unsigned long long>(index));
+  return directory_ + "/" + name + std::string(kSegmentSuffix);
+}
+
+std::shared_ptr<Journal::Segment> Journal::segment_(std::uint64_t index, bool create) {
+  std::lock_guard<std::mutex> lock(segments_mutex_);
+  if (auto it = segments_.find(index); it != segments_.end()) {
+    return it->second;
+  }
+
+  int fd = ::open(segment_path_(index).c_str(), O_RDWR | O_CLOEXEC | (create ? O_CREAT : 0), 0644);
+  if (fd < 0) {
+    return nullptr;
+  }
+
+  // New files are sparse and read as zeroes, which is Kind::kEnd everywhere
+  struct stat info;
+  void* base = MAP_FAILED;
+  if (fstat(fd, &info) == 0 && (static_cast<std::size_t>(info.st_size) >= segment_size_ || ftruncate(fd, static_cast<off_t>(segment_size_)) == 0)) {
+    base = mmap(nullptr, segment_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  }
+  if (base == MAP_FAILED) {
+    auto error = errno;
+    close(fd);
+    errno = error;
+    return nullptr;
+  }
+
+  std::shared_ptr<Segment> segment(new Segment{index, fd, static_cast<char*>(base), segment_size_});
+  segments_.emplace(index, segment);
+  return segment;
+}
+
+bool Journal::recover_() {
+  std::set<std::uint64_t> indexes;
+  std::error_code error;
+  for (const auto& entry : std::filesystem::directory_iterator(directory_, error)) {
+    auto name = entry.path().filename().string();
+    if (name.size() <= kSegmentSuffix.size() || !name.ends_with(kSegmentSuffix)) {
+      continue;
+    }
+    auto stem = name.substr(0, name.size() - kSegmentSuffix.size());
+    if (std::all_of(stem.begin(), stem.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+      indexes.insert(std::stoull(stem));
+    }
+  }
+  if (error) {
+    errno = error.value();
+    return false;
+  }
+
+  // Existing segments decide the segment size, offsets would not line up otherwise
+  if (!indexes.empty()) {
+    struct stat info;
+    if (stat(segment_path_(*indexes.begin()).c_str(), &info) != 0) {
+      return false;
+    }
+    if (info.st_size <= static_cast<off_t>(kHeaderSize) || info.st_size % kAlignment != 0) {
+      errno = EINVAL;
+      return false;
+    }
+    segment_size_ = static_cast<std::size_t>(info.st_size);
+  }
+
+  std::uint64_t pop_cursor = 0;
+  if (int fd = ::open(checkpoint_path_().c_str(), O_RDONLY | O_CLOEXEC); fd >= 0) {
+    if (read(fd, &pop_cursor, sizeof(pop_cursor)) != sizeof(pop_cursor)) {
+      pop_cursor = 0;
+    }
+    close(fd);
+  }
+
+  std::uint64_t push_cursor = pop_cursor;
+  if (!indexes.empty()) {
+    pop_cursor = std::max(pop_cursor, *indexes.begin() * segment_size_);
+
+    // Segments before the last written one are complete, the stream ends at its first unwritten header.
+    // Newer segments can only be empty ones the flusher mapped ahead of the producer.
+    for (auto it = indexes.rbegin(); it != indexes.rend(); ++it) {
+      auto segment = segment_(*it, false);
+      if (segment == nullptr) {
+        return false;
+      }
+      std::size_t offset = 0;
+      while (offset + kHeaderSize <= segment_size_) {
+        const auto* header = header_at(segment->base, offset);
+        if (header->kind == Kind::kPadding) {
+          offset = segment_size_;
+        } else if (header->kind == Kind::kRecord && header->size <= max_record_size() && offset + record_span(header->size) <= segment_size_) {
+          offset += record_span(header->size);
+          continue;
+        }
+        break;
+      }
+
+      push_cursor = *it * segment_size_ + offset;
+      if (offset > 0) {
+        break;
+      }
+    }
+    pop_cursor = std::min(pop_cursor, push_cursor);
+  }
+
+  // Leftovers of a crash between checkpointing and unlinking
+  for (auto index : indexes) {
+    if (index >= pop_cursor / segment_size_) {
+      break;
+    }
+    unlink(segment_path_(index).c_str());
+  }
+
+  push_cursor_.store(push_cursor, std::memory_order_relaxed);
+  pop_cursor_.store(pop_cursor, std::memory_order_relaxed);
+  durable_cursor_.store(push_cursor, std::memory_order_relaxed);
+  cached_push_cursor_ = push_cursor;
+  checkpoint_cursor_ = pop_cursor;
+  return true;
+}
+
+void Journal::run_flusher_() {
+  std::unique_lock<std::mutex> stop_lock(stop_mutex_);
+  while (!stop_) {
+    stop_cv_.wait_for(stop_lock, flush_interval_, [this] { return stop_; });
+    stop_lock.unlock();
+    {
+      std::lock_guard<std::mutex> lock(flush_mutex_);
+      sync_();
+      checkpoint_();
+      roll_segments_();
+    }
+    stop_lock.lock();
+  }
+}
+
+void Journal::sync_() {
+  auto push_cursor = push_cursor_.load(std::memory_order_acquire);
+  auto from = durable_cursor_.load(std::memory_order_relaxed);
+
+  for (auto index = from / segment_size_; index * segment_size_ < push_cursor; ++index) {
+    auto segment = segment_(index, false);
+    if (segment == nullptr) {
+      continue;
+    }
+    auto begin = std::max(from, index * segment_size_) - index * segment_size_;
+    auto end = std::min(push_cursor, (index + 1) * segment_size_) - index * segment_size_;
+    begin = begin / page_size() * page_size();
+    msync(segment->base + begin, end - begin, MS_SYNC);
+  }
+  durable_cursor_.store(push_cursor, std::memory_order_release);
+}
+
+void Journal::checkpoint_() {
+  auto pop_cursor = pop_cursor_.load(std::memory_order_acquire);
+  if (pop_cursor == checkpoint_cursor_) {
+    return;
+  }
+
+  // Written aside and renamed over, a crash leaves either the old or the new offset
+  auto temporary = checkpoint_path_() + ".tmp";
+  int fd = ::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (fd < 0) {
+    return;
+  }
+  auto written = write(fd, &pop_cursor, sizeof(pop_cursor)) == sizeof(pop_cursor) && fsync(fd) == 0;
+  close(fd);
+  if (!written || rename(temporary.c_str(), checkpoint_path_().c_str()) != 0) {
+    return;
+  }
+  if (int directory = ::open(directory_.c_str(), O_RDONLY | O_CLOEXEC); directory >= 0) {
+    fsync(directory);
+    close(directory);
+  }
+
+  checkpoint_cursor_ = pop_cursor;
+}
+
+void Journal::roll_segments_() {
+  // Map the next segment early so that the producer does not create files on its hot path. A failure here
+  // is retried by the producer itself.
+  auto push_cursor = push_cursor_.load(std::memory_order_relaxed);
+  if (push_cursor % segment_size_ >= segment_size_ / 2) {
+    segment_(push_cursor / segment_size_ + 1, true);
+  }
+
+  std::lock_guard<std::mutex> lock(segments_mutex_);
+  auto first_needed = checkpoint_cursor_ / segment_size_;
+  for (auto it = segments_.begin(); it != segments_.end() && it->first < first_needed;) {
+    unlink(segment_path_(it->first).c_str());
+    it = segments_.erase(it);
+  }
+}
+}  // namespace nyx::journal
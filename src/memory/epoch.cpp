@@ -0,0 +1,173 @@
+#include "include/epoch.hpp"
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <vector>
+
+#include "src/common/include/define.hpp"
+
+namespace nyx::memory::epoch {
+namespace {
+using common::define::hardware_constructive_interference_size;
+
+constexpr std::size_t kPinnedBit = 1;
+
+struct Retired {
+  void* ptr;
+  Deleter deleter;
+};
+
+// One per registered thread. Records are never freed, a record released by an exiting thread is
+// reused by the next thread that registers, together with the garbage it still holds.
+struct alignas(hardware_constructive_interference_size) Record {
+  // (epoch << 1) | pinned, read by every thread that tries to advance the epoch
+  std::atomic<std::size_t> state{0};
+  std::atomic<bool> in_use{true};
+  Record* next{nullptr};
+
+  // Owner thread only
+  std::size_t nesting{0};
+  std::size_t retired_since_collect{0};
+  std::array<std::vector<Retired>, 3> limbo;
+  std::array<std::size_t, 3> limbo_epoch{};
+};
+
+alignas(hardware_constructive_interference_size) std::atomic<std::size_t> global_epoch{0};
+alignas(hardware_constructive_interference_size) std::atomic<Record*> records{nullptr};
+
+void free_limbo(std::vector<Retired>& limbo) {
+  for (auto& retired : limbo) {
+    retired.deleter(retired.ptr);
+  }
+  limbo.clear();
+}
+
+Record* acquire_record() {
+  for (Record* record = records.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+    bool expected = false;
+    if (!record->in_use.load(std::memory_order_relaxed) &&
+        record->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire, std::memory_order_relaxed)) {
+      return record;
+    }
+  }
+
+  auto record = new Record;
+  auto head = records.load(std::memory_order_relaxed);
+  do {
+    record->next = head;
+  } while (!records.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+
+  return record;
+}
+
+bool try_advance(std::size_t epoch) {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  for (Record* record = records.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+    auto state = record->state.load(std::memory_order_acquire);
+    if ((state & kPinnedBit) && (state >> 1) != epoch) {
+      return false;
+    }
+  }
+
+  return global_epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_release, std::memory_order_relaxed);
+}
+
+void collect(Record* record) {
+  try_advance(global_epoch.load(std::memory_order_relaxed));
+
+  auto epoch = global_epoch.load(std::memory_order_acquire);
+  for (std::size_t i = 0; i < record->limbo.size(); ++i) {
+    if (!record->limbo[i].empty() && record->limbo_epoch[i] + 2 <= epoch) {
+      free_limbo(record->limbo[i]);
+    }
+  }
+  record->retired_since_collect = 0;
+}
+
+struct ThreadHandle {
+  Record* record{nullptr};
+
+  ~ThreadHandle() { release(); }
+
+  Record* get() {
+    if (record == nullptr) {
+      record = acquire_record();
+    }
+    return record;
+  }
+
+  void release() {
+    if (record == nullptr) {
+      return;
+    }
+
+    assert(record->nesting == 0);
+    collect(record);
+    record->state.store(0, std::memory_order_release);
+    record->in_use.store(false, std::memory_order_release);
+    record = nullptr;
+  }
+};
+
+thread_local ThreadHandle handle;
+}  // namespace
+
+void register_thread() { handle.get(); }
+
+void unregister_thread() { handle.release(); }
+
+void pin() {
+  Record* record = handle.get();
+  if (record->nesting++ != 0) {
+    return;
+  }
+
+  auto epoch = global_epoch.load(std::memory_order_relaxed);
+  record->state.store((epoch << 1) | kPinnedBit, std::memory_order_relaxed);
+  // Orders the pin before every pointer this thread reads afterwards
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+void unpin() {
+  Record* record = handle.get();
+  assert(record->nesting > 0);
+  if (--record->nesting != 0) {
+    return;
+  }
+
+  record->state.store(0, std::memory_order_release);
+}
+
+bool is_pinned() { return handle.get()->nesting != 0; }
+
+void retire(void* ptr, Deleter deleter) {
+  Record* record = handle.get();
+  auto epoch = global_epoch.load(std::memory_order_acquire);
+
+  // A bucket holding an older epoch of the same residue is at least three epochs old
+  auto index = epoch % record->limbo.size();
+  if (record->limbo_epoch[index] != epoch) {
+    free_limbo(record->limbo[index]);
+    record->limbo_epoch[index] = epoch;
+  }
+  record->limbo[index].push_back({ptr, deleter});
+
+  if (++record->retired_since_collect >= kCollectInterval) {
+    collect(record);
+  }
+}
+
+void collect() { collect(handle.get()); }
+
+std::size_t pending() {
+  std::size_t count = 0;
+  for (auto& limbo : handle.get()->limbo) {
+    count += limbo.size();
+  }
+  return count;
+}
+
+std::size_t current_epoch() { return global_epoch.load(std::memory_order_relaxed); }
+}  // namespace nyx::memory::epoch
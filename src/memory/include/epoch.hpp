@@ -0,0 +1,55 @@
+#ifndef MEMORY_EPOCH_HPP
+#define MEMORY_EPOCH_HPP
+
+// Epoch-based memory reclamation.
+//
+// Readers pin the current epoch while they hold pointers into a lock-free structure. A writer that
+// unlinks a node retires it instead of deleting it; the node is freed once the global epoch has
+// advanced twice past the epoch it was retired in, at which point no pinned reader can still see it.
+// Threads register themselves on first use and unregister when they exit.
+
+#include <cstddef>
+
+namespace nyx::memory::epoch {
+// retire() tries to advance the epoch and free garbage every kCollectInterval retirements.
+constexpr std::size_t kCollectInterval = 64;
+
+using Deleter = void (*)(void*);
+
+// Explicit registration is optional, every other call registers the calling thread lazily.
+void register_thread();
+void unregister_thread();
+
+// Pins are re-entrant: only the outermost pin/unpin pair publishes anything.
+void pin();
+void unpin();
+bool is_pinned();
+
+// Defers deleter(ptr) until no thread pinned at the time of the call can still reach ptr.
+void retire(void* ptr, Deleter deleter);
+
+template <typename T>
+void retire(T* ptr) {
+  retire(static_cast<void*>(ptr), [](void* p) { delete static_cast<T*>(p); });
+}
+
+// Tries to advance the global epoch and frees whatever the calling thread retired that became safe.
+void collect();
+
+// Number of objects retired by the calling thread that are not freed yet.
+std::size_t pending();
+
+std::size_t current_epoch();
+
+// RAII pin for the current scope.
+class Guard {
+ public:
+  Guard() { pin(); }
+  ~Guard() { unpin(); }
+
+  Guard(const Guard&) = delete;
+  Guard& operator=(const Guard&) = delete;
+};
+}  // namespace nyx::memory::epoch
+
+#endif  // !MEMORY_EPOCH_HPP
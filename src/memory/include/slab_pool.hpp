@@ -0,0 +1,63 @@
+#ifndef MEMORY_SLAB_POOL_HPP
+#define MEMORY_SLAB_POOL_HPP
+
+// Thread-aware slab pool for small, short-lived objects.
+//
+// Blocks come in size classes of kGranularity bytes up to kMaxSize. Every thread caches free blocks per
+// class, so allocating and freeing are a pop and a push on a thread local list. Blocks are allowed to be
+// freed on another thread than the one that allocated them: a cache that grows past two batches hands a
+// batch to the class's central list, where the allocating thread picks it up again once its own cache runs
+// dry. In a steady producer/consumer pattern no call reaches malloc. Fresh blocks are carved from slabs
+// that are kept for the lifetime of the process. Larger sizes go straight to ::operator new.
+
+#include <cstddef>
+#include <new>
+
+namespace nyx::memory {
+class SlabPool {
+ public:
+  static constexpr std::size_t kGranularity = alignof(std::max_align_t);
+  static constexpr std::size_t kMaxSize = 512;
+  // Blocks moved between a thread cache and the central list at once
+  static constexpr std::size_t kBatch = 32;
+
+  // Blocks are aligned to kGranularity.
+  static void* allocate(std::size_t size);
+  // size must be the one passed to allocate.
+  static void deallocate(void* ptr, std::size_t size) noexcept;
+};
+
+// Stateless allocator over SlabPool, over-aligned types fall back to ::operator new.
+template <typename T>
+class SlabAllocator {
+ public:
+  using value_type = T;
+
+  SlabAllocator() noexcept = default;
+  template <typename U>
+  SlabAllocator(const SlabAllocator<U>&) noexcept {}
+
+  T* allocate(std::size_t n) {
+    if constexpr (alignof(T) > SlabPool::kGranularity) {
+      return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{alignof(T)}));
+    } else {
+      return static_cast<T*>(SlabPool::allocate(n * sizeof(T)));
+    }
+  }
+
+  void deallocate(T* ptr, std::size_t n) noexcept {
+    if constexpr (alignof(T) > SlabPool::kGranularity) {
+      ::operator delete(ptr, std::align_val_t{alignof(T)});
+    } else {
+      SlabPool::deallocate(ptr, n * sizeof(T));
+    }
+  }
+
+  template <typename U>
+  bool operator==(const SlabAllocator<U>&) const noexcept {
+    return true;
+  }
+};
+}  // namespace nyx::memory
+
+#endif  // !MEMORY_SLAB_POOL_HPP
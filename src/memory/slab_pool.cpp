@@ -0,0 +1,168 @@
+#include "include/slab_pool.hpp"
+
+#include <array>
+#include <mutex>
+
+namespace nyx::memory {
+namespace {
+constexpr std::size_t kClasses = SlabPool::kMaxSize / SlabPool::kGranularity;
+constexpr std::size_t kSlabSize = 64 * 1024;
+
+// A free block. Chains of blocks are linked through next, batches on the central list through next_batch
+// of their first block.
+struct Block {
+  Block* next;
+  Block* next_batch;
+};
+static_assert(sizeof(Block) <= SlabPool::kGranularity);
+static_assert(kSlabSize >= SlabPool::kMaxSize * SlabPool::kBatch);
+
+struct Central {
+  std::mutex mutex;
+  Block* batches{nullptr};
+};
+
+// Never freed: exiting threads flush their cache into it, possibly after static destructors ran
+Central* centrals() {
+  static auto* centrals = new Central[kClasses];
+  return centrals;
+}
+
+std::size_t class_of(std::size_t size) noexcept { return size == 0 ? 0 : (size - 1) / SlabPool::kGranularity; }
+std::size_t block_size(std::size_t size_class) noexcept { return (size_class + 1) * SlabPool::kGranularity; }
+
+void push_batch(std::size_t size_class, Block* batch) {
+  auto& central = centrals()[size_class];
+  std::lock_guard<std::mutex> lock(central.mutex);
+  batch->next_batch = central.batches;
+  central.batches = batch;
+}
+
+Block* pop_batch(std::size_t size_class) {
+  auto& central = centrals()[size_class];
+  std::lock_guard<std::mutex> lock(central.mutex);
+  auto* batch = central.batches;
+  if (batch != nullptr) {
+    central.batches = batch->next_batch;
+  }
+  return batch;
+}
+
+// Set once the calling thread's cache is destroyed, later calls bypass it
+thread_local bool cache_destroyed = false;
+
+class ThreadCache {
+  struct List {
+    Block* head{nullptr};
+    std::size_t count{0};
+  };
+  std::array<List, kClasses> lists_;
+
+ public:
+  ~ThreadCache() {
+    cache_destroyed = true;
+    for (std::size_t size_class = 0; size_class < kClasses; ++size_class) {
+      if (lists_[size_class].head != nullptr) {
+        push_batch(size_class, lists_[size_class].head);
+      }
+    }
+  }
+
+  void* pop(std::size_t size_class) {
+    auto& list = lists_[size_class];
+    if (list.head == nullptr) {
+      refill_(size_class, list);
+    }
+
+    auto* block = list.head;
+    list.head = block->next;
+    --list.count;
+    return block;
+  }
+
+  void push(std::size_t size_class, void* ptr) {
+    auto& list = lists_[size_class];
+    auto* block = static_cast<Block*>(ptr);
+    block->next = list.head;
+    list.head = block;
+    if (++list.count <= 2 * SlabPool::kBatch) {
+      return;
+    }
+
+    // Hand the most recently freed batch to the threads that allocate
+    auto* last = list.head;
+    for (std::size_t i = 1; i < SlabPool::kBatch; ++i) {
+      last = last->next;
+    }
+    auto* batch = list.head;
+    list.head = last->next;
+    last->next = nullptr;
+    list.count -= SlabPool::kBatch;
+    push_batch(size_class, batch);
+  }
+
+ private:
+  static void refill_(std::size_t size_class, List& list) {
+    if (auto* batch = pop_batch(size_class)) {
+      list.head = batch;
+      for (auto* block = batch; block != nullptr; block = block->next) {
+        ++list.count;
+      }
+      return;
+    }
+
+    // Carve a fresh slab into batches, this thread keeps the first one and the others go to the central list
+    auto size = block_size(size_class);
+    auto* slab = static_cast<char*>(::operator new(kSlabSize));
+    auto blocks = kSlabSize / size;
+    for (std::size_t first = 0; first < blocks; first += SlabPool::kBatch) {
+      auto last = first + SlabPool::kBatch < blocks ? first + SlabPool::kBatch : blocks;
+      for (auto i = first; i < last; ++i) {
+        reinterpret_cast<Block*>(slab + i * size)->next = i + 1 < last ? reinterpret_cast<Block*>(slab + (i + 1) * size) : nullptr;
+      }
+
+      auto* batch = reinterpret_cast<Block*>(slab + first * size);
+      if (first == 0) {
+        list.head = batch;
+        list.count = last;
+      } else {
+        push_batch(size_class, batch);
+      }
+    }
+  }
+};
+
+thread_local ThreadCache cache;
+}  // namespace
+
+void* SlabPool::allocate(std::size_t size) {
+  if (size > kMaxSize) {
+    return ::operator new(size);
+  }
+  auto size_class = class_of(size);
+  if (cache_destroyed) {
+    // Joins the pool once freed, a block of the class is all it takes
+    return ::operator new(block_size(size_class));
+  }
+  return cache.pop(size_class);
+}
+
+void SlabPool::deallocate(void* ptr, std::size_t size) noexcept {
+  if (ptr == nullptr) {
+    return;
+  }
+  if (size > kMaxSize) {
+    ::operator delete(ptr);
+    return;
+  }
+
+  auto size_class = class_of(size);
+  if (cache_destroyed) {
+    auto* block = static_cast<Block*>(ptr);
+    block->next = nullptr;
+    push_batch(size_class, block);
+    return;
+  }
+  cache.push(size_class, ptr);
+}
+}  // namespace nyx::memory
@@ -48,8 +48,6 @@ int lmb(const std::size_t& x) noexcept {
   return 64 - clz(x) - 1;
 }
 
-bool is_power_of_two(const std::size_t& x) noexcept { return x > 0 && (x & (x - 1)) == 0; }
-
 void turn_on_bit(std::size_t& x, const uint8_t& pos) noexcept { x |= 1LL << pos; }
 
 void turn_off_bit(std::size_t& x, const uint8_t& pos) noexcept { x &= ~(1LL << pos); }
@@ -1,6 +1,8 @@
 #ifndef UTILS_RAND_HPP
 #define UTILS_RAND_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 namespace nyx::utils::rand {
@@ -20,6 +22,25 @@ class Xorshift {
   static std::size_t x_, y_, z_, w_;
 };
 
+// Zipf-distributed integers in [0, n), 0 being the most frequent, as in YCSB (Gray et al., SIGMOD'94).
+// Has its own xorshift state so that each thread can own a generator.
+class Zipfian {
+ public:
+  explicit Zipfian(std::size_t n, double theta = 0.99, std::uint64_t seed = 88172645463325252ULL);
+
+  std::size_t next() noexcept;
+
+ private:
+  double uniform_() noexcept;
+
+  std::size_t n_;
+  double theta_;
+  double alpha_;
+  double zetan_;
+  double eta_;
+  std::uint64_t state_;
+};
+
 std::vector<std::size_t> rand_list(size_t size, size_t element_size) noexcept;
 std::vector<std::pair<size_t, size_t>> rand_list_pair(size_t size, size_t first_limit, size_t second_limit) noexcept;
 }  // namespace nyx::utils::rand
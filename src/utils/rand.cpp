@@ -1,5 +1,8 @@
 #include "include/rand.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 #include "src/utils/include/time.hpp"
 
 namespace nyx::utils::rand {
@@ -8,6 +11,38 @@ std::size_t Xorshift::y_ = time::now();
 std::size_t Xorshift::z_ = time::now();
 std::size_t Xorshift::w_ = time::now();
 
+Zipfian::Zipfian(std::size_t n, double theta, std::uint64_t seed) : n_(n), theta_(theta), state_(seed == 0 ? 1 : seed) {
+  double zeta2 = 1.0 + std::pow(0.5, theta_);
+  zetan_ = 0;
+  for (std::size_t i = 1; i <= n_; ++i) {
+    zetan_ += 1.0 / std::pow(static_cast<double>(i), theta_);
+  }
+
+  alpha_ = 1.0 / (1.0 - theta_);
+  eta_ = (1.0 - std::pow(2.0 / static_cast<double>(n_), 1.0 - theta_)) / (1.0 - zeta2 / zetan_);
+}
+
+std::size_t Zipfian::next() noexcept {
+  double u = uniform_();
+  double uz = u * zetan_;
+  if (uz < 1.0) {
+    return 0;
+  }
+  if (uz < 1.0 + std::pow(0.5, theta_)) {
+    return 1;
+  }
+
+  auto value = static_cast<std::size_t>(static_cast<double>(n_) * std::pow(eta_ * u - eta_ + 1.0, alpha_));
+  return std::min(value, n_ - 1);
+}
+
+double Zipfian::uniform_() noexcept {
+  state_ ^= state_ << 13;
+  state_ ^= state_ >> 7;
+  state_ ^= state_ << 17;
+  return static_cast<double>(state_ >> 11) * 0x1.0p-53;
+}
+
 std::vector<size_t> rand_list(size_t size, size_t element_size) noexcept {
   std::vector<size_t> ret(size);
   std::for_each(ret.begin(), ret.end(), [&](size_t &x) { x = Xorshift::next() % element_size; });
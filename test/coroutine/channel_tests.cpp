@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "src/coroutine/include/channel.hpp"
+#include "src/coroutine/include/scheduler.hpp"
+
+using namespace nyx::coroutine;
+
+namespace {
+Task produce(Channel<int>& channel, int count) {
+  for (int i = 0; i < count; ++i) {
+    co_await channel.send(i);
+  }
+  channel.close();
+}
+
+Task consume(Channel<int>& channel, std::vector<int>& received) {
+  while (auto value = co_await channel.recv()) {
+    received.push_back(*value);
+  }
+}
+
+Task forward(Channel<int>& in, Channel<int>& out) {
+  while (auto value = co_await in.recv()) {
+    co_await out.send(*value + 1);
+  }
+  out.close();
+}
+}  // namespace
+
+TEST(ChannelTest, BoundedChannelParksProducer) {
+  Scheduler scheduler;
+  Channel<int> channel(2);
+  std::vector<int> received;
+
+  scheduler.spawn(produce(channel, 10));
+  scheduler.poll();
+  EXPECT_EQ(channel.size(), 2) << "Producer is parked on the full channel";
+
+  scheduler.spawn(consume(channel, received));
+  scheduler.poll();
+  EXPECT_EQ(received, std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+TEST(ChannelTest, UnbufferedChannelIsARendezvous) {
+  Scheduler scheduler;
+  Channel<std::string> channel(0);
+  std::vector<std::string> log;
+
+  scheduler.spawn([](Channel<std::string>& channel, std::vector<std::string>& log) -> Task {
+    log.push_back("send");
+    co_await channel.send("ping");
+    log.push_back("sent");
+  }(channel, log));
+  scheduler.poll();
+  EXPECT_EQ(log, std::vector<std::string>({"send"}));
+  EXPECT_EQ(channel.size(), 0);
+
+  EXPECT_EQ(channel.try_recv(), "ping");
+  scheduler.poll();
+  EXPECT_EQ(log, std::vector<std::string>({"send", "sent"}));
+}
+
+TEST(ChannelTest, CloseWakesParkedCoroutines) {
+  Scheduler scheduler;
+  Channel<int> empty(1), full(1);
+  ASSERT_TRUE(full.try_send(1));
+
+  std::optional<int> received = 42;
+  bool sent = true;
+  scheduler.spawn([](Channel<int>& channel, std::optional<int>& received) -> Task { received = co_await channel.recv(); }(empty, received));
+  scheduler.spawn([](Channel<int>& channel, bool& sent) -> Task { sent = co_await channel.send(2); }(full, sent));
+  scheduler.poll();
+
+  empty.close();
+  full.close();
+  scheduler.poll();
+  EXPECT_EQ(received, std::nullopt);
+  EXPECT_FALSE(sent);
+  EXPECT_EQ(full.try_recv(), 1) << "Buffered values outlive close";
+  EXPECT_FALSE(full.try_send(3));
+}
+
+TEST(ChannelTest, SelectReceivesFromReadyChannel) {
+  Scheduler scheduler;
+  Channel<int> a, b;
+  std::vector<SelectResult<int>> results;
+
+  scheduler.spawn([](Channel<int>& a, Channel<int>& b, std::vector<SelectResult<int>>& results) -> Task {
+    for (int i = 0; i < 3; ++i) {
+      results.push_back(co_await select(a, b));
+    }
+  }(a, b, results));
+  scheduler.poll();
+  EXPECT_TRUE(results.empty());
+
+  b.try_send(1);
+  scheduler.poll();
+  a.try_send(2);
+  b.close();
+  scheduler.poll();
+
+  ASSERT_EQ(results.size(), 3);
+  EXPECT_EQ(results[0].index, 1);
+  EXPECT_EQ(results[0].value, 1);
+  EXPECT_EQ(results[1].index, 0) << "Ready channels are tried in order";
+  EXPECT_EQ(results[1].value, 2);
+  EXPECT_EQ(results[2].index, 1);
+  EXPECT_EQ(results[2].value, std::nullopt);
+
+  // The losing case of the last select did not leave a stale receiver behind
+  EXPECT_TRUE(a.try_send(3));
+  EXPECT_EQ(a.try_recv(), 3);
+}
+
+TEST(ChannelTest, OneThreadDrivesThousandsOfStages) {
+  constexpr int kStages = 2000;
+  Scheduler scheduler;
+  std::vector<std::unique_ptr<Channel<int>>> channels;
+  for (int i = 0; i <= kStages; ++i) {
+    channels.push_back(std::make_unique<Channel<int>>(1));
+  }
+
+  std::vector<int> received;
+  for (int i = 0; i < kStages; ++i) {
+    scheduler.spawn(forward(*channels[i], *channels[i + 1]));
+  }
+  scheduler.spawn(consume(*channels[kStages], received));
+  scheduler.spawn(produce(*channels[0], 50));
+  scheduler.poll();
+
+  ASSERT_EQ(received.size(), 50);
+  for (int i = 0; i < 50; ++i) {
+    EXPECT_EQ(received[i], i + kStages);
+  }
+}
+
+TEST(ChannelTest, SchedulersOnDifferentThreads) {
+  Scheduler producer_scheduler, consumer_scheduler;
+  Channel<int> channel(8);
+  std::vector<int> received;
+  constexpr int kValues = 20'000;
+
+  producer_scheduler.spawn(produce(channel, kValues));
+  consumer_scheduler.spawn([](Channel<int>& channel, std::vector<int>& received) -> Task {
+    while (auto value = co_await channel.recv()) {
+      received.push_back(*value);
+    }
+    Scheduler::current()->stop();
+  }(channel, received));
+
+  // The consumer sleeps in run() while parked and is woken by the producer's sends
+  std::thread consumer([&] { consumer_scheduler.run(); });
+  while (!channel.closed()) {
+    producer_scheduler.poll();
+    std::this_thread::yield();
+  }
+  consumer.join();
+
+  ASSERT_EQ(received.size(), kValues);
+  for (int i = 0; i < kValues; ++i) {
+    ASSERT_EQ(received[i], i);
+  }
+}
@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "src/data_structure/blocking_scsp_queue.hpp"
+
+using namespace nyx;
+
+template <typename Strategy>
+class BlockingScspQueueTest : public ::testing::Test {};
+
+using Strategies = ::testing::Types<nyx::data_structure::wait_strategy::BusySpin, nyx::data_structure::wait_strategy::SpinThenYield<>,
+                                    nyx::data_structure::wait_strategy::Futex<>>;
+TYPED_TEST_SUITE(BlockingScspQueueTest, Strategies);
+
+TYPED_TEST(BlockingScspQueueTest, TryOperations) {
+  nyx::data_structure::BlockingScspQueue<int, TypeParam> queue(2);
+
+  int value;
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_TRUE(queue.try_push(1));
+  EXPECT_TRUE(queue.try_push(2));
+  EXPECT_FALSE(queue.try_push(3));  // Queue should be full now
+
+  queue.pop(value);
+  EXPECT_EQ(value, 1);
+  queue.pop(value);
+  EXPECT_EQ(value, 2);
+  EXPECT_TRUE(queue.empty());
+}
+
+TYPED_TEST(BlockingScspQueueTest, ConsumerBlocksUntilPush) {
+  nyx::data_structure::BlockingScspQueue<int, TypeParam> queue(4);
+
+  int value = -1;
+  std::thread consumer([&]() { queue.pop(value); });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  queue.push(42);
+  consumer.join();
+
+  EXPECT_EQ(value, 42);
+}
+
+TYPED_TEST(BlockingScspQueueTest, ProducerConsumer) {
+  const int num_elements = 5000;
+  nyx::data_structure::BlockingScspQueue<int, TypeParam> queue(16);
+
+  std::thread producer([&]() {
+    for (int i = 0; i < num_elements; ++i) {
+      queue.push(i);
+    }
+  });
+
+  std::vector<int> consumed;
+  consumed.reserve(num_elements);
+  for (int i = 0; i < num_elements; ++i) {
+    int value;
+    queue.pop(value);
+    consumed.push_back(value);
+  }
+  producer.join();
+
+  for (int i = 0; i < num_elements; ++i) {
+    ASSERT_EQ(consumed[i], i);
+  }
+}
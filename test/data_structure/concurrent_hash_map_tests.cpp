@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "src/data_structure/concurrent_hash_map.hpp"
+
+using nyx::data_structure::ConcurrentHashMap;
+
+TEST(ConcurrentHashMapTest, InsertFindErase) {
+  ConcurrentHashMap<int, std::string> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.find(1), std::nullopt);
+
+  EXPECT_TRUE(map.insert_or_assign(1, "one"));
+  EXPECT_FALSE(map.insert_or_assign(1, "uno"));
+  EXPECT_EQ(map.find(1), "uno");
+  EXPECT_EQ(map.size(), 1);
+
+  EXPECT_TRUE(map.erase(1));
+  EXPECT_FALSE(map.erase(1));
+  EXPECT_FALSE(map.contains(1));
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(ConcurrentHashMapTest, ComputeInsertsUpdatesAndErases) {
+  ConcurrentHashMap<std::string, int> map;
+  auto increment = [](std::optional<int>& value) { value = value.value_or(0) + 1; };
+
+  EXPECT_EQ(map.compute("a", increment), 1);
+  EXPECT_EQ(map.compute("a", increment), 2);
+  EXPECT_EQ(map.find("a"), 2);
+
+  EXPECT_EQ(map.compute("a", [](std::optional<int>& value) { value.reset(); }), std::nullopt);
+  EXPECT_FALSE(map.contains("a"));
+  EXPECT_EQ(map.compute("b", [](std::optional<int>&) {}), std::nullopt) << "Absent key left absent";
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(ConcurrentHashMapTest, GrowsIncrementally) {
+  ConcurrentHashMap<int, int> map(0, 4);
+  auto buckets = map.bucket_count();
+
+  for (int i = 0; i < 100'000; ++i) {
+    map.insert_or_assign(i, i * 2);
+  }
+  EXPECT_GT(map.bucket_count(), buckets);
+  EXPECT_EQ(map.size(), 100'000);
+
+  for (int i = 0; i < 100'000; ++i) {
+    ASSERT_EQ(map.find(i), i * 2) << "key " << i;
+  }
+}
+
+TEST(ConcurrentHashMapTest, ConcurrentComputeCountsEveryIncrement) {
+  ConcurrentHashMap<int, int> map;
+  constexpr int kThreads = 4;
+  constexpr int kKeys = 1000;
+  constexpr int kRounds = 20;
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&] {
+      for (int round = 0; round < kRounds; ++round) {
+        for (int key = 0; key < kKeys; ++key) {
+          map.compute(key, [](std::optional<int>& value) { value = value.value_or(0) + 1; });
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(map.size(), kKeys);
+  for (int key = 0; key < kKeys; ++key) {
+    ASSERT_EQ(map.find(key), kThreads * kRounds);
+  }
+}
+
+TEST(ConcurrentHashMapTest, ReadersSeeConsistentValuesWhileWritersResize) {
+  ConcurrentHashMap<int, std::string> map(0, 8);
+  constexpr int kWriters = 2;
+  constexpr int kKeysPerWriter = 20'000;
+
+  std::atomic<bool> done{false};
+  std::atomic<std::size_t> mismatches{0};
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 2; ++t) {
+    readers.emplace_back([&] {
+      while (!done.load(std::memory_order_acquire)) {
+        for (int key = 0; key < kWriters * kKeysPerWriter; key += 97) {
+          // A value is always the string of its key, whether it was assigned once or twice
+          if (auto value = map.find(key); value && *value != std::to_string(key)) {
+            mismatches.fetch_add(1);
+          }
+        }
+      }
+    });
+  }
+
+  std::vector<std::thread> writers;
+  for (int t = 0; t < kWriters; ++t) {
+    writers.emplace_back([&, t] {
+      for (int i = 0; i < kKeysPerWriter; ++i) {
+        int key = i * kWriters + t;
+        map.insert_or_assign(key, std::to_string(key));
+        if (i % 3 == 0) {
+          map.erase(key);
+        } else if (i % 3 == 1) {
+          map.insert_or_assign(key, std::to_string(key));
+        }
+      }
+    });
+  }
+  for (auto& writer : writers) {
+    writer.join();
+  }
+  done.store(true, std::memory_order_release);
+  for (auto& reader : readers) {
+    reader.join();
+  }
+
+  EXPECT_EQ(mismatches.load(), 0);
+  std::size_t expected = 0;
+  for (int key = 0; key < kWriters * kKeysPerWriter; ++key) {
+    bool present = (key / kWriters) % 3 != 0;
+    ASSERT_EQ(map.contains(key), present) << "key " << key;
+    expected += present;
+  }
+  EXPECT_EQ(map.size(), expected);
+}
@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "src/data_structure/flat_hash_map.hpp"
+#include "src/data_structure/priority_queue.hpp"
+#include "src/data_structure/unique_list.hpp"
+#include "src/utils/include/rand.hpp"
+
+using nyx::data_structure::FlatHashMap;
+
+TEST(FlatHashMapTest, InsertFindErase) {
+  FlatHashMap<int, int> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.find(1), map.end());
+
+  EXPECT_TRUE(map.try_emplace(1, 10).second);
+  EXPECT_FALSE(map.try_emplace(1, 20).second);
+  EXPECT_EQ(map.at(1), 10);
+
+  map[2] = 20;
+  EXPECT_FALSE(map.insert_or_assign(2, 21).second);
+  EXPECT_EQ(map.find(2)->second, 21);
+  EXPECT_TRUE(map.contains(2));
+  EXPECT_EQ(map.size(), 2);
+
+  EXPECT_EQ(map.erase(1), 1);
+  EXPECT_EQ(map.erase(1), 0);
+  EXPECT_FALSE(map.contains(1));
+  EXPECT_THROW(map.at(1), std::out_of_range);
+  EXPECT_EQ(map.size(), 1);
+}
+
+TEST(FlatHashMapTest, MatchesUnorderedMapUnderRandomOperations) {
+  FlatHashMap<int, int> map;
+  std::unordered_map<int, int> expected;
+
+  auto keys = nyx::utils::rand::rand_list(100'000, 5'000);
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    auto key = keys[i];
+    switch (i % 3) {
+      case 0:
+      case 1:
+        map[key] = static_cast<int>(i);
+        expected[key] = static_cast<int>(i);
+        break;
+      case 2:
+        ASSERT_EQ(map.erase(key), expected.erase(key));
+        break;
+    }
+    ASSERT_EQ(map.size(), expected.size());
+  }
+
+  for (const auto& [key, value] : expected) {
+    ASSERT_EQ(map.at(key), value) << "key " << key;
+  }
+
+  std::size_t visited = 0;
+  for (const auto& [key, value] : map) {
+    ASSERT_EQ(expected.at(key), value);
+    ++visited;
+  }
+  EXPECT_EQ(visited, expected.size());
+}
+
+TEST(FlatHashMapTest, ReserveAvoidsRehash) {
+  FlatHashMap<int, int> map;
+  map.reserve(1000);
+  auto capacity = map.capacity();
+  EXPECT_GE(capacity, 1000);
+
+  for (int i = 0; i < 1000; ++i) {
+    map.try_emplace(i, i);
+  }
+  EXPECT_EQ(map.capacity(), capacity);
+}
+
+TEST(FlatHashMapTest, TombstonesAreReclaimed) {
+  FlatHashMap<int, int> map;
+  map.reserve(100);
+  auto capacity = map.capacity();
+
+  // A sliding window of keys keeps the size constant, deleted slots must not grow the table forever
+  for (int i = 0; i < 100'000; ++i) {
+    map.try_emplace(i, i);
+    if (i >= 50) {
+      ASSERT_EQ(map.erase(i - 50), 1);
+    }
+  }
+  EXPECT_EQ(map.size(), 50);
+  EXPECT_EQ(map.capacity(), capacity);
+  for (int i = 100'000 - 50; i < 100'000; ++i) {
+    EXPECT_TRUE(map.contains(i));
+  }
+}
+
+TEST(FlatHashMapTest, EraseWhileIterating) {
+  FlatHashMap<int, int> map;
+  for (int i = 0; i < 1000; ++i) {
+    map[i] = i;
+  }
+
+  for (auto it = map.begin(); it != map.end();) {
+    if (it->first % 2 == 0) {
+      it = map.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  EXPECT_EQ(map.size(), 500);
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(map.contains(i), i % 2 == 1);
+  }
+}
+
+TEST(FlatHashMapTest, OwnsNonTrivialValues) {
+  FlatHashMap<std::string, std::unique_ptr<std::string>> map;
+  for (int i = 0; i < 100; ++i) {
+    auto key = std::to_string(i);
+    map.try_emplace(key, std::make_unique<std::string>(key));
+  }
+
+  auto copy = std::move(map);
+  EXPECT_TRUE(map.empty());
+  ASSERT_EQ(copy.size(), 100);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(*copy.at(std::to_string(i)), std::to_string(i));
+  }
+
+  copy.clear();
+  EXPECT_TRUE(copy.empty());
+  EXPECT_FALSE(copy.contains("1"));
+}
+
+TEST(FlatHashMapTest, CopyIsIndependent) {
+  FlatHashMap<std::string, int> map;
+  map["a"] = 1;
+  map["b"] = 2;
+
+  auto copy = map;
+  copy["a"] = 10;
+  copy.erase("b");
+
+  EXPECT_EQ(map.at("a"), 1);
+  EXPECT_EQ(map.at("b"), 2);
+  EXPECT_EQ(copy.at("a"), 10);
+  EXPECT_FALSE(copy.contains("b"));
+}
+
+namespace {
+struct StringHash {
+  using is_transparent = void;
+  std::size_t operator()(std::string_view value) const noexcept { return std::hash<std::string_view>{}(value); }
+};
+}  // namespace
+
+TEST(FlatHashMapTest, HeterogeneousLookup) {
+  FlatHashMap<std::string, int, StringHash, std::equal_to<>> map;
+  map["alpha"] = 1;
+  map["beta"] = 2;
+
+  std::string_view key = "alpha";
+  auto it = map.find(key);
+  ASSERT_NE(it, map.end());
+  EXPECT_EQ(it->second, 1);
+  EXPECT_TRUE(map.contains("beta"));
+  EXPECT_EQ(map.count(std::string_view("gamma")), 0);
+  EXPECT_EQ(map.erase(std::string_view("beta")), 1);
+  EXPECT_EQ(map.size(), 1);
+}
+
+TEST(FlatHashMapTest, DropInForPriorityQueue) {
+  nyx::data_structure::priority_queue<int, FlatHashMap> pq;
+  for (int i = 0; i < 100; ++i) {
+    int value = i;
+    pq.push_no_update(std::move(value), static_cast<uint8_t>(i % 8));
+  }
+  int moved = 7;
+  pq.push_and_update(std::move(moved), 63);
+  pq.remove(15);
+
+  EXPECT_TRUE(pq.is_exsit(7));
+  EXPECT_FALSE(pq.is_exsit(15));
+  EXPECT_EQ(pq.get_priority(7), 63);
+
+  int out = -1;
+  ASSERT_TRUE(pq.try_pop(out));
+  EXPECT_EQ(out, 7);
+  ASSERT_TRUE(pq.try_pop(out));
+  EXPECT_EQ(out, 23) << "15 was removed, next element of priority 7";
+}
+
+TEST(FlatHashMapTest, DropInForUniqueList) {
+  nyx::data_structure::UniqueList<int, std::hash<int>, FlatHashMap> unique_list(std::vector<int>{1, 2, 3, 2});
+  EXPECT_EQ(unique_list.size(), 3);
+  EXPECT_TRUE(unique_list.contain(2));
+  EXPECT_EQ(unique_list.replace(2, 4), decltype(unique_list)::SUCCESS);
+  EXPECT_FALSE(unique_list.contain(2));
+  EXPECT_TRUE(unique_list.pop(4));
+
+  int out = 0;
+  ASSERT_TRUE(unique_list.pop_back(out));
+  EXPECT_EQ(out, 3);
+  EXPECT_EQ(*unique_list.begin(), 1);
+}
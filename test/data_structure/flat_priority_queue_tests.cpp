@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "src/data_structure/flat_priority_queue.hpp"
+#include "src/data_structure/hierarchical_priority_queue.hpp"
+#include "src/utils/include/rand.hpp"
+
+namespace nyx::data_structure {
+
+class FlatPriorityQueueTest : public ::testing::Test {
+ protected:
+  flat_priority_queue<int> pq;
+
+  void TearDown() override { pq.clear(); }
+};
+
+TEST_F(FlatPriorityQueueTest, PopsHighestPriorityFirst) {
+  pq.push_no_update(1, 10);
+  pq.push_no_update(2, 4095);
+  pq.push_no_update(3, 0);
+  pq.push_no_update(4, 700);
+
+  EXPECT_EQ(pq.size(), 4);
+  EXPECT_EQ(pq.top(), 2);
+  EXPECT_EQ(pq.top_priority(), 4095);
+
+  int popped;
+  for (int expected : {2, 4, 1, 3}) {
+    ASSERT_TRUE(pq.try_pop(popped));
+    EXPECT_EQ(popped, expected);
+  }
+  EXPECT_FALSE(pq.try_pop(popped));
+  EXPECT_TRUE(pq.empty());
+}
+
+TEST_F(FlatPriorityQueueTest, SamePriorityIsFifo) {
+  for (int i = 0; i < 5; ++i) {
+    pq.push_no_update(int{i}, 2000);
+  }
+  pq.remove(2);
+
+  int popped;
+  for (int expected : {0, 1, 3, 4}) {
+    ASSERT_TRUE(pq.try_pop(popped));
+    EXPECT_EQ(popped, expected);
+  }
+}
+
+TEST_F(FlatPriorityQueueTest, UpdateAndRemove) {
+  pq.push_no_update(7, 100);
+  pq.push_no_update(8, 200);
+  pq.push_no_update(7, 3000);
+  EXPECT_EQ(pq.get_priority(7), 100);
+
+  pq.push_and_update(7, 3000);
+  EXPECT_EQ(pq.get_priority(7), 3000);
+  EXPECT_EQ(pq.top(), 7);
+
+  pq.remove(7);
+  pq.remove(9);
+  EXPECT_FALSE(pq.is_exsit(7));
+  EXPECT_FALSE(pq.get_priority(7).has_value());
+  EXPECT_EQ(pq.top(), 8);
+  EXPECT_EQ(pq.size(), 1);
+
+  // Freed slot is reused
+  pq.push_and_update(7, 1);
+  EXPECT_EQ(pq.get_priority(7), 1);
+  EXPECT_EQ(pq.size(), 2);
+}
+
+TEST_F(FlatPriorityQueueTest, NonTrivialElements) {
+  flat_priority_queue<std::string, 64> names;
+  names.push_no_update("low", 1);
+  names.push_no_update("high", 63);
+  names.push_and_update("low", 62);
+
+  std::string popped;
+  ASSERT_TRUE(names.try_pop(popped));
+  EXPECT_EQ(popped, "high");
+  ASSERT_TRUE(names.try_pop(popped));
+  EXPECT_EQ(popped, "low");
+  EXPECT_FALSE(names.is_exsit("low"));
+}
+
+TEST_F(FlatPriorityQueueTest, MatchesHierarchicalPriorityQueue) {
+  hierarchical_priority_queue<int> expected;
+  pq.reserve(1 << 12);
+
+  for (int i = 0; i < 200000; ++i) {
+    int value = static_cast<int>(utils::rand::Xorshift::next() % 5000);
+    auto priority = static_cast<uint16_t>(utils::rand::Xorshift::next() % 4096);
+
+    switch (utils::rand::Xorshift::next() % 4) {
+      case 0:
+        pq.push_no_update(int{value}, priority);
+        expected.push_no_update(int{value}, priority);
+        break;
+      case 1:
+        pq.push_and_update(int{value}, priority);
+        expected.push_and_update(int{value}, priority);
+        break;
+      case 2:
+        pq.remove(value);
+        expected.remove(value);
+        break;
+      default: {
+        int lhs = -1, rhs = -1;
+        ASSERT_EQ(pq.try_pop(lhs), expected.try_pop(rhs));
+        ASSERT_EQ(lhs, rhs);
+      }
+    }
+
+    ASSERT_EQ(pq.size(), expected.size());
+    ASSERT_EQ(pq.get_priority(value), expected.get_priority(value));
+  }
+}
+
+}  // namespace nyx::data_structure
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <list>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "src/data_structure/flat_unique_list.hpp"
+#include "src/utils/include/rand.hpp"
+
+using nyx::data_structure::FlatUniqueList;
+
+TEST(FlatUniqueListTest, PushPopOperations) {
+  FlatUniqueList<int> unique_list;
+
+  ASSERT_TRUE(unique_list.empty()) << "Expected unique_list to be empty initially.";
+
+  auto mock_data = nyx::utils::rand::rand_list(1000, 1000);
+  for (auto it : mock_data) {
+    unique_list.push_back(it);
+  }
+
+  std::unordered_set<int> s(mock_data.begin(), mock_data.end());
+  ASSERT_EQ(unique_list.size(), s.size());
+
+  for (auto it : s) {
+    ASSERT_TRUE(unique_list.contain(it)) << "Expected unique_list to contain " << it;
+  }
+
+  while (unique_list.size()) {
+    int value = 0;
+    ASSERT_TRUE(unique_list.pop_back(value));
+    ASSERT_TRUE(s.find(value) != s.end());
+    s.erase(value);
+  }
+  EXPECT_TRUE(s.empty());
+}
+
+TEST(FlatUniqueListTest, IteratesInInsertionOrder) {
+  FlatUniqueList<int> unique_list;
+  for (int value : {5, 3, 5, 9, 1, 3}) {
+    unique_list.push_back(value);
+  }
+  unique_list.pop(9);
+  unique_list.push_back(7);
+
+  std::vector<int> values(unique_list.begin(), unique_list.end());
+  EXPECT_EQ(values, (std::vector<int>{5, 3, 1, 7}));
+
+  auto last = unique_list.end();
+  EXPECT_EQ(*--last, 7);
+}
+
+TEST(FlatUniqueListTest, TryGetNodeAndReplace) {
+  auto mock_data = nyx::utils::rand::rand_list(10000, 10000);
+  FlatUniqueList<std::size_t> unique_list(mock_data);
+
+  int rand_pos = nyx::utils::rand::Xorshift::next() % mock_data.size();
+  auto it = unique_list.try_get_node(mock_data[rand_pos]);
+  ASSERT_TRUE(it.has_value());
+  EXPECT_EQ(*it.value(), mock_data[rand_pos]);
+  EXPECT_FALSE(unique_list.try_get_node(10001).has_value());
+
+  std::size_t value = mock_data[0];
+  EXPECT_EQ(unique_list.replace(value, 10001), FlatUniqueList<std::size_t>::SUCCESS);
+  EXPECT_FALSE(unique_list.contain(value));
+  EXPECT_TRUE(unique_list.contain(10001));
+  EXPECT_EQ(*unique_list.begin(), 10001) << "Replaced element keeps its position";
+
+  EXPECT_EQ(unique_list.replace(10001, mock_data[1]), FlatUniqueList<std::size_t>::DUPLICATE_HASH);
+  EXPECT_EQ(unique_list.replace(20000, 30000), FlatUniqueList<std::size_t>::KEY_NOT_FOUND);
+}
+
+TEST(FlatUniqueListTest, NonTrivialElements) {
+  FlatUniqueList<std::string> unique_list;
+  EXPECT_TRUE(unique_list.push_back("a"));
+  EXPECT_TRUE(unique_list.push_back("b"));
+  EXPECT_FALSE(unique_list.push_back("a"));
+  EXPECT_TRUE(unique_list.pop("a"));
+  EXPECT_TRUE(unique_list.push_back("c"));
+
+  std::string out;
+  ASSERT_TRUE(unique_list.pop_back(out));
+  EXPECT_EQ(out, "c");
+  ASSERT_TRUE(unique_list.pop_back(out));
+  EXPECT_EQ(out, "b");
+  EXPECT_FALSE(unique_list.pop_back(out));
+}
+
+TEST(FlatUniqueListTest, MatchesListAndSet) {
+  FlatUniqueList<std::size_t> unique_list;
+  std::list<std::size_t> expected;
+  std::unordered_set<std::size_t> members;
+
+  for (int i = 0; i < 100000; ++i) {
+    std::size_t value = nyx::utils::rand::Xorshift::next() % 2000;
+    if (nyx::utils::rand::Xorshift::next() % 2 == 0) {
+      ASSERT_EQ(unique_list.push_back(value), members.insert(value).second);
+      if (expected.size() != members.size()) {
+        expected.push_back(value);
+      }
+    } else {
+      ASSERT_EQ(unique_list.pop(value), members.erase(value) == 1);
+      expected.remove(value);
+    }
+    ASSERT_EQ(unique_list.size(), members.size());
+  }
+
+  std::vector<std::size_t> values(unique_list.begin(), unique_list.end());
+  EXPECT_EQ(values, std::vector<std::size_t>(expected.begin(), expected.end()));
+}
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <set>
+
+#include "src/data_structure/hierarchical_bitmap.hpp"
+#include "src/utils/include/rand.hpp"
+
+namespace nyx::data_structure {
+
+template <typename Bitmap>
+class HierarchicalBitmapTest : public ::testing::Test {
+ protected:
+  Bitmap bitmap;
+};
+
+using BitmapTypes = ::testing::Types<HierarchicalBitmap<64>, HierarchicalBitmap<4096>, HierarchicalBitmap<5000>, HierarchicalBitmap<262144>>;
+TYPED_TEST_SUITE(HierarchicalBitmapTest, BitmapTypes);
+
+TYPED_TEST(HierarchicalBitmapTest, StartsEmpty) {
+  EXPECT_TRUE(this->bitmap.empty());
+  EXPECT_EQ(this->bitmap.highest(), TypeParam::npos);
+  EXPECT_EQ(this->bitmap.lowest(), TypeParam::npos);
+}
+
+TYPED_TEST(HierarchicalBitmapTest, SetAndReset) {
+  auto last = TypeParam::bits() - 1;
+
+  this->bitmap.set(0);
+  this->bitmap.set(last);
+  EXPECT_TRUE(this->bitmap.test(0));
+  EXPECT_TRUE(this->bitmap.test(last));
+  EXPECT_EQ(this->bitmap.highest(), last);
+  EXPECT_EQ(this->bitmap.lowest(), 0);
+
+  this->bitmap.reset(last);
+  EXPECT_FALSE(this->bitmap.test(last));
+  EXPECT_EQ(this->bitmap.highest(), 0);
+
+  this->bitmap.reset(0);
+  EXPECT_TRUE(this->bitmap.empty());
+}
+
+TYPED_TEST(HierarchicalBitmapTest, MatchesOrderedSet) {
+  std::set<std::size_t> expected;
+  for (int i = 0; i < 10000; ++i) {
+    std::size_t index = utils::rand::Xorshift::next() % TypeParam::bits();
+    if (utils::rand::Xorshift::next() % 3 == 0) {
+      this->bitmap.reset(index);
+      expected.erase(index);
+    } else {
+      this->bitmap.set(index);
+      expected.insert(index);
+    }
+
+    ASSERT_EQ(this->bitmap.empty(), expected.empty());
+    if (!expected.empty()) {
+      ASSERT_EQ(this->bitmap.highest(), *expected.rbegin());
+      ASSERT_EQ(this->bitmap.lowest(), *expected.begin());
+    }
+  }
+}
+
+}  // namespace nyx::data_structure
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include "src/data_structure/hierarchical_priority_queue.hpp"
+
+namespace nyx::data_structure {
+
+class HierarchicalPriorityQueueTest : public ::testing::Test {
+ protected:
+  hierarchical_priority_queue<int> pq;
+
+  void TearDown() override { pq.clear(); }
+};
+
+TEST_F(HierarchicalPriorityQueueTest, PopsHighestPriorityFirst) {
+  pq.push_no_update(1, 10);
+  pq.push_no_update(2, 4095);
+  pq.push_no_update(3, 0);
+  pq.push_no_update(4, 700);
+
+  EXPECT_EQ(pq.size(), 4);
+  EXPECT_EQ(pq.top(), 2);
+  EXPECT_EQ(pq.top_priority(), 4095);
+
+  int popped;
+  for (int expected : {2, 4, 1, 3}) {
+    ASSERT_TRUE(pq.try_pop(popped));
+    EXPECT_EQ(popped, expected);
+  }
+  EXPECT_FALSE(pq.try_pop(popped));
+  EXPECT_TRUE(pq.empty());
+  EXPECT_EQ(pq.size(), 0);
+}
+
+TEST_F(HierarchicalPriorityQueueTest, SamePriorityIsFifo) {
+  for (int i = 0; i < 5; ++i) {
+    pq.push_no_update(int{i}, 2000);
+  }
+
+  int popped;
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_TRUE(pq.try_pop(popped));
+    EXPECT_EQ(popped, i);
+  }
+}
+
+TEST_F(HierarchicalPriorityQueueTest, PushNoUpdateKeepsPriority) {
+  pq.push_no_update(7, 100);
+  pq.push_no_update(7, 3000);
+
+  EXPECT_EQ(pq.size(), 1);
+  EXPECT_EQ(pq.get_priority(7), 100);
+}
+
+TEST_F(HierarchicalPriorityQueueTest, PushAndUpdateMovesElement) {
+  pq.push_no_update(7, 100);
+  pq.push_no_update(8, 200);
+  pq.push_and_update(7, 3000);
+
+  EXPECT_EQ(pq.get_priority(7), 3000);
+  EXPECT_EQ(pq.top(), 7);
+
+  pq.push_and_update(7, 1);
+  EXPECT_EQ(pq.top(), 8);
+  EXPECT_EQ(pq.size(), 2);
+}
+
+TEST_F(HierarchicalPriorityQueueTest, RemoveAndReinsert) {
+  pq.push_no_update(1, 64);
+  pq.push_no_update(2, 65);
+  pq.remove(2);
+  pq.remove(3);
+
+  EXPECT_FALSE(pq.is_exsit(2));
+  EXPECT_FALSE(pq.get_priority(2).has_value());
+  EXPECT_EQ(pq.top_priority(), 64);
+
+  int popped;
+  ASSERT_TRUE(pq.try_pop(popped));
+  EXPECT_EQ(popped, 1);
+  EXPECT_FALSE(pq.is_exsit(1));
+
+  // A popped element can be pushed again
+  pq.push_no_update(1, 5);
+  EXPECT_EQ(pq.get_priority(1), 5);
+}
+
+TEST_F(HierarchicalPriorityQueueTest, ThreeLevelBitmap) {
+  hierarchical_priority_queue<int, 100000> deadlines;
+  for (int i = 0; i < 1000; ++i) {
+    deadlines.push_no_update(int{i}, static_cast<uint32_t>(i * 97 % 100000));
+  }
+
+  uint32_t last = 100000;
+  int popped;
+  while (!deadlines.empty()) {
+    auto priority = deadlines.top_priority().value();
+    ASSERT_TRUE(deadlines.try_pop(popped));
+    EXPECT_LT(priority, last);
+    EXPECT_EQ(static_cast<uint32_t>(popped * 97 % 100000), priority);
+    last = priority;
+  }
+}
+
+}  // namespace nyx::data_structure
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "src/data_structure/intrusive_mpsc_queue.hpp"
+
+using namespace nyx::data_structure;
+
+namespace {
+struct Message : MpscHook<> {
+  int producer{0};
+  int sequence{0};
+};
+
+struct Inbox {};
+struct Outbox {};
+// Can wait in two queues at once
+struct Letter : MpscHook<Inbox>, MpscHook<Outbox> {
+  int id{0};
+};
+}  // namespace
+
+TEST(IntrusiveMpscQueueTest, PopsInFifoOrder) {
+  IntrusiveMpscQueue<Message> queue;
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(queue.pop(), nullptr);
+
+  std::vector<Message> messages(10);
+  for (int i = 0; i < 10; ++i) {
+    messages[i].sequence = i;
+    queue.push(&messages[i]);
+  }
+  EXPECT_FALSE(queue.empty());
+
+  for (int i = 0; i < 10; ++i) {
+    auto* message = queue.pop();
+    ASSERT_NE(message, nullptr);
+    EXPECT_EQ(message->sequence, i);
+  }
+  EXPECT_EQ(queue.pop(), nullptr);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(IntrusiveMpscQueueTest, ElementsCanBeRequeued) {
+  IntrusiveMpscQueue<Message> queue;
+  Message message;
+
+  for (int round = 0; round < 3; ++round) {
+    queue.push(&message);
+    EXPECT_EQ(queue.pop(), &message);
+    EXPECT_EQ(queue.pop(), nullptr);
+  }
+}
+
+TEST(IntrusiveMpscQueueTest, TagsSelectTheHook) {
+  IntrusiveMpscQueue<Letter, Inbox> inbox;
+  IntrusiveMpscQueue<Letter, Outbox> outbox;
+  Letter a, b;
+  a.id = 1;
+  b.id = 2;
+
+  inbox.push(&a);
+  inbox.push(&b);
+  outbox.push(&b);
+  outbox.push(&a);
+
+  EXPECT_EQ(inbox.pop()->id, 1);
+  EXPECT_EQ(outbox.pop()->id, 2);
+  EXPECT_EQ(inbox.pop()->id, 2);
+  EXPECT_EQ(outbox.pop()->id, 1);
+}
+
+TEST(IntrusiveMpscQueueTest, ManyProducersKeepPerProducerOrder) {
+  IntrusiveMpscQueue<Message> queue;
+  constexpr int kProducers = 8;
+  constexpr int kMessages = 20'000;
+
+  std::vector<std::unique_ptr<Message[]>> messages;
+  for (int p = 0; p < kProducers; ++p) {
+    messages.push_back(std::make_unique<Message[]>(kMessages));
+  }
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducers; ++p) {
+    producers.emplace_back([&, p] {
+      for (int i = 0; i < kMessages; ++i) {
+        messages[p][i].producer = p;
+        messages[p][i].sequence = i;
+        queue.push(&messages[p][i]);
+      }
+    });
+  }
+
+  std::vector<int> next(kProducers, 0);
+  for (int received = 0; received < kProducers * kMessages;) {
+    auto* message = queue.pop();
+    if (message == nullptr) {
+      std::this_thread::yield();
+      continue;
+    }
+    ASSERT_EQ(message->sequence, next[message->producer]++);
+    ++received;
+  }
+
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  EXPECT_EQ(queue.pop(), nullptr);
+  EXPECT_EQ(next, std::vector<int>(kProducers, kMessages));
+}
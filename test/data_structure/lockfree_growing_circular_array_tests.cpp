@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+
+#include "src/data_structure/lockfree_growing_circular_array.hpp"
+
+using nyx::data_structure::LockfreeGrowingCircularArray;
+
+TEST(LockfreeGrowingCircularArrayTest, CapacityIsRoundedToPowerOfTwo) {
+  LockfreeGrowingCircularArray<int, 8, 64> array(10);
+  EXPECT_EQ(array.capacity(), 16);
+
+  LockfreeGrowingCircularArray<int, 8, 64> small(1);
+  EXPECT_EQ(small.capacity(), 8);
+
+  LockfreeGrowingCircularArray<int, 8, 64> huge(1000);
+  EXPECT_EQ(huge.capacity(), 64);
+  EXPECT_FALSE(huge.can_grow());
+}
+
+TEST(LockfreeGrowingCircularArrayTest, GrowKeepsLiveRange) {
+  LockfreeGrowingCircularArray<int, 4, 16> array;
+  int values[16];
+
+  // Live range [6, 10) wraps around the initial ring of 4 slots
+  for (int i = 6; i < 10; ++i) {
+    array.put(i, &values[i]);
+  }
+
+  ASSERT_TRUE(array.can_grow());
+  array.grow(10, 6);
+  EXPECT_EQ(array.capacity(), 8);
+  for (int i = 6; i < 10; ++i) {
+    EXPECT_EQ(array.get(i), &values[i]);
+  }
+
+  array.put(10, &values[10]);
+  array.put(13, &values[13]);
+  EXPECT_EQ(array.get(10), &values[10]);
+  EXPECT_EQ(array.get(13), &values[13]);
+  EXPECT_EQ(array.get(6), &values[6]);
+
+  array.grow(14, 6);
+  EXPECT_EQ(array.capacity(), 16);
+  EXPECT_FALSE(array.can_grow());
+  EXPECT_EQ(array.get(13), &values[13]);
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "src/data_structure/mpmc_lockfree_queue.hpp"
+
+using namespace nyx;
+
+TEST(MpmcLockFreeQueueTest, BasicOperations) {
+  nyx::data_structure::MpmcLockFreeQueue<int> queue(5);
+
+  int value;
+  EXPECT_FALSE(queue.pop(value));
+  EXPECT_TRUE(queue.empty());
+
+  EXPECT_TRUE(queue.push(1));
+  EXPECT_TRUE(queue.push(2));
+  EXPECT_TRUE(queue.push(3));
+  EXPECT_TRUE(queue.push(4));
+  EXPECT_TRUE(queue.push(5));
+  EXPECT_FALSE(queue.push(6));  // Queue should be full now
+  EXPECT_EQ(queue.size(), 5);
+
+  for (int i = 1; i <= 5; ++i) {
+    EXPECT_TRUE(queue.pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(queue.pop(value));  // Queue should be empty now
+}
+
+TEST(MpmcLockFreeQueueTest, WrapAround) {
+  nyx::data_structure::MpmcLockFreeQueue<int> queue(3);
+
+  int value;
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_TRUE(queue.push(i));
+    EXPECT_TRUE(queue.push(i + 1000));
+    EXPECT_TRUE(queue.pop(value));
+    EXPECT_EQ(value, i);
+    EXPECT_TRUE(queue.pop(value));
+    EXPECT_EQ(value, i + 1000);
+  }
+}
+
+TEST(MpmcLockFreeQueueTest, DestroysRemainingElements) {
+  auto counter = std::make_shared<int>(0);
+  {
+    nyx::data_structure::MpmcLockFreeQueue<std::shared_ptr<int>> queue(4);
+    EXPECT_TRUE(queue.push(counter));
+    EXPECT_TRUE(queue.push(counter));
+    EXPECT_EQ(counter.use_count(), 3);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(MpmcLockFreeQueueTest, MultiProducerMultiConsumer) {
+  const int num_producers = 4;
+  const int num_consumers = 4;
+  const int num_elements = 20000;
+  nyx::data_structure::MpmcLockFreeQueue<int> queue(64);
+
+  std::vector<std::vector<int>> consumed(num_consumers);
+  std::atomic<int> remaining{num_producers * num_elements};
+
+  std::vector<std::thread> threads;
+  for (int p = 0; p < num_producers; ++p) {
+    threads.emplace_back([&, p]() {
+      for (int i = 0; i < num_elements; ++i) {
+        while (!queue.push(p * num_elements + i)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  for (int c = 0; c < num_consumers; ++c) {
+    threads.emplace_back([&, c]() {
+      int value;
+      while (remaining.load(std::memory_order_relaxed) > 0) {
+        if (queue.pop(value)) {
+          consumed[c].push_back(value);
+          remaining.fetch_sub(1, std::memory_order_relaxed);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  std::vector<int> all;
+  for (auto& part : consumed) {
+    all.insert(all.end(), part.begin(), part.end());
+  }
+
+  ASSERT_EQ(all.size(), num_producers * num_elements);
+  std::sort(all.begin(), all.end());
+  for (int i = 0; i < num_producers * num_elements; ++i) {
+    EXPECT_EQ(all[i], i);
+  }
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "src/data_structure/mpmc_priority_queue.hpp"
+
+using namespace nyx;
+
+TEST(MpmcPriorityQueueTest, PopsHighestPriorityFirst) {
+  nyx::data_structure::MpmcPriorityQueue<int> queue(4);
+
+  int value;
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_TRUE(queue.empty());
+
+  EXPECT_TRUE(queue.push(1, 0));
+  EXPECT_TRUE(queue.push(2, 63));
+  EXPECT_TRUE(queue.push(3, 10));
+  EXPECT_TRUE(queue.push(4, 10));
+  EXPECT_EQ(queue.size(), 4);
+
+  for (int expected : {2, 3, 4, 1}) {
+    ASSERT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, expected);
+  }
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(MpmcPriorityQueueTest, EmptyAfterLastPop) {
+  nyx::data_structure::MpmcPriorityQueue<int> queue(4);
+
+  // The last successful pop leaves the level's marker bit set
+  EXPECT_TRUE(queue.push(1, 3));
+  EXPECT_FALSE(queue.empty());
+
+  int value;
+  ASSERT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_EQ(queue.size(), 0);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(MpmcPriorityQueueTest, LevelsAreBoundedIndependently) {
+  nyx::data_structure::MpmcPriorityQueue<int, 8> queue(2);
+
+  EXPECT_TRUE(queue.push(1, 7));
+  EXPECT_TRUE(queue.push(2, 7));
+  EXPECT_FALSE(queue.push(3, 7));
+  EXPECT_TRUE(queue.push(3, 6));
+
+  int value;
+  ASSERT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_TRUE(queue.push(4, 7));
+}
+
+TEST(MpmcPriorityQueueTest, MultiProducerMultiConsumer) {
+  const int num_producers = 3;
+  const int num_consumers = 3;
+  const int per_producer = 20000;
+
+  nyx::data_structure::MpmcPriorityQueue<int> queue(1024);
+  std::atomic<int> remaining{num_producers * per_producer};
+  std::vector<std::vector<int>> popped(num_consumers);
+
+  std::vector<std::thread> threads;
+  for (int p = 0; p < num_producers; ++p) {
+    threads.emplace_back([&queue, p, per_producer] {
+      for (int i = 0; i < per_producer; ++i) {
+        int value = p * per_producer + i;
+        while (!queue.push(value, static_cast<uint8_t>(value % 64))) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (int c = 0; c < num_consumers; ++c) {
+    threads.emplace_back([&queue, &remaining, &popped, c] {
+      int value;
+      while (remaining.load(std::memory_order_relaxed) > 0) {
+        if (queue.try_pop(value)) {
+          popped[c].push_back(value);
+          remaining.fetch_sub(1, std::memory_order_relaxed);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  std::vector<int> all;
+  for (auto& part : popped) {
+    all.insert(all.end(), part.begin(), part.end());
+  }
+  ASSERT_EQ(all.size(), num_producers * per_producer);
+  std::sort(all.begin(), all.end());
+  for (int i = 0; i < num_producers * per_producer; ++i) {
+    ASSERT_EQ(all[i], i);
+  }
+  EXPECT_TRUE(queue.empty());
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "src/data_structure/multicast_ring.hpp"
+
+using namespace nyx::data_structure;
+
+namespace {
+struct Event {
+  std::uint64_t value{0};
+  std::uint64_t doubled{0};
+  std::uint64_t squared{0};
+};
+}  // namespace
+
+TEST(MulticastRingTest, EveryConsumerSeesEveryEvent) {
+  MulticastRing<int> ring(8);
+  auto& first = ring.add_consumer();
+  auto& second = ring.add_consumer();
+
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_TRUE(ring.try_publish([i](int& slot) { slot = i; }));
+  }
+
+  std::vector<int> seen_first, seen_second;
+  EXPECT_EQ(first.poll([&](int& value, std::size_t) { seen_first.push_back(value); }), 5);
+  EXPECT_EQ(second.poll([&](int& value, std::size_t) { seen_second.push_back(value); }, 2), 2);
+  EXPECT_EQ(second.poll([&](int& value, std::size_t) { seen_second.push_back(value); }), 3);
+
+  EXPECT_EQ(seen_first, std::vector<int>({0, 1, 2, 3, 4}));
+  EXPECT_EQ(seen_second, seen_first);
+  EXPECT_EQ(first.available(), 0);
+}
+
+TEST(MulticastRingTest, ProducerGatesOnSlowestConsumer) {
+  MulticastRing<int> ring(4);
+  auto& fast = ring.add_consumer();
+  auto& slow = ring.add_consumer();
+
+  EXPECT_EQ(ring.try_claim(8), 4);
+  for (std::size_t i = 0; i < 4; ++i) {
+    ring[ring.cursor() + i] = static_cast<int>(i);
+  }
+  ring.publish(4);
+  EXPECT_EQ(ring.try_claim(), 0);
+
+  fast.poll([](int&, std::size_t) {});
+  EXPECT_EQ(ring.try_claim(), 0) << "Slow consumer still holds every slot";
+
+  EXPECT_EQ(slow.poll([](int&, std::size_t) {}, 3), 3);
+  EXPECT_EQ(ring.try_claim(8), 3);
+}
+
+TEST(MulticastRingTest, DependentStageSeesEarlierStageWrites) {
+  MulticastRing<Event> ring(8);
+  auto& doubler = ring.add_consumer();
+  auto& reader = ring.add_consumer({&doubler});
+
+  ring.try_publish([](Event& event) { event.value = 21; });
+  EXPECT_EQ(reader.available(), 0) << "Barrier is the doubler, not the cursor";
+
+  doubler.poll([](Event& event, std::size_t) { event.doubled = event.value * 2; });
+  std::uint64_t doubled = 0;
+  EXPECT_EQ(reader.poll([&](Event& event, std::size_t) { doubled = event.doubled; }), 1);
+  EXPECT_EQ(doubled, 42);
+}
+
+template <typename WaitStrategy>
+void run_diamond() {
+  // Two parallel stages annotate every event, a third one depends on both of them
+  MulticastRing<Event, WaitStrategy> ring(64);
+  auto& doubler = ring.add_consumer();
+  auto& squarer = ring.add_consumer();
+  auto& checker = ring.add_consumer({&doubler, &squarer});
+
+  constexpr std::uint64_t kEvents = 100'000;
+  auto stage = [](auto& consumer, auto&& handler) {
+    std::uint64_t handled = 0;
+    while (handled < kEvents) {
+      consumer.wait();
+      handled += consumer.poll(handler);
+    }
+  };
+
+  std::thread doubling([&] { stage(doubler, [](Event& event, std::size_t) { event.doubled = event.value * 2; }); });
+  std::thread squaring([&] { stage(squarer, [](Event& event, std::size_t) { event.squared = event.value * event.value; }); });
+  std::uint64_t errors = 0;
+  std::thread checking([&] {
+    stage(checker, [&](Event& event, std::size_t sequence) {
+      errors += event.value != sequence || event.doubled != sequence * 2 || event.squared != sequence * sequence;
+    });
+  });
+
+  for (std::uint64_t sequence = 0; sequence < kEvents;) {
+    auto count = ring.claim(16);
+    for (std::size_t i = 0; i < count; ++i) {
+      ring[sequence + i].value = sequence + i;
+    }
+    ring.publish(count);
+    sequence += count;
+  }
+
+  doubling.join();
+  squaring.join();
+  checking.join();
+  EXPECT_EQ(errors, 0);
+  EXPECT_EQ(checker.sequence(), kEvents);
+}
+
+TEST(MulticastRingTest, DiamondPipelineSpinThenYield) { run_diamond<wait_strategy::SpinThenYield<>>(); }
+
+TEST(MulticastRingTest, DiamondPipelineFutex) { run_diamond<wait_strategy::Futex<>>(); }
@@ -2,7 +2,12 @@
 
 #include <algorithm>
 #include <chrono>
+#include <iterator>
+#include <memory>
+#include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include "src/data_structure/scsp_lockfree_queue.hpp"
 #include "src/utils/include/time.hpp"
@@ -75,3 +80,121 @@ TEST(ScspLockFreeQueueTest, MultiThread) {
     EXPECT_EQ(i, consumed[i]);
   }
 }
+
+TEST(ScspLockFreeQueueTest, BulkOperations) {
+  nyx::data_structure::ScspLockFreeQueue<int> queue(5);
+
+  std::vector<int> input{1, 2, 3, 4, 5, 6, 7};
+  EXPECT_EQ(queue.push_bulk(input.begin(), input.end()), 5);  // Only capacity elements fit
+  EXPECT_EQ(queue.push_bulk(input.begin(), input.end()), 0);
+
+  std::vector<int> output;
+  EXPECT_EQ(queue.pop_bulk(std::back_inserter(output), 3), 3);
+  EXPECT_EQ(output, std::vector<int>({1, 2, 3}));
+
+  // Wrap around the end of the ring
+  EXPECT_EQ(queue.push_bulk(input.begin() + 5, input.end()), 2);
+  EXPECT_EQ(queue.pop_bulk(std::back_inserter(output), 10), 4);
+  EXPECT_EQ(output, std::vector<int>({1, 2, 3, 4, 5, 6, 7}));
+  EXPECT_EQ(queue.pop_bulk(std::back_inserter(output), 10), 0);
+}
+
+TEST(ScspLockFreeQueueTest, BulkMoveOnly) {
+  nyx::data_structure::ScspLockFreeQueue<std::unique_ptr<int>> queue(4);
+
+  std::vector<std::unique_ptr<int>> input;
+  for (int i = 0; i < 3; ++i) {
+    input.push_back(std::make_unique<int>(i));
+  }
+  EXPECT_EQ(queue.push_bulk(std::make_move_iterator(input.begin()), std::make_move_iterator(input.end())), 3);
+
+  std::unique_ptr<int> output[3];
+  EXPECT_EQ(queue.pop_bulk(output, 3), 3);
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_NE(output[i], nullptr);
+    EXPECT_EQ(*output[i], i);
+  }
+}
+
+TEST(ScspLockFreeQueueTest, BulkMultiThread) {
+  const int num_elements = 100000;
+  const int batch = 32;
+  nyx::data_structure::ScspLockFreeQueue<int> queue(100);
+
+  std::thread producer([&]() {
+    std::vector<int> buffer(batch);
+    for (int i = 0; i < num_elements;) {
+      int n = std::min(batch, num_elements - i);
+      for (int j = 0; j < n; ++j) {
+        buffer[j] = i + j;
+      }
+
+      int pushed = 0;
+      while (pushed < n) {
+        auto count = queue.push_bulk(buffer.begin() + pushed, buffer.begin() + n);
+        if (count == 0) {
+          std::this_thread::yield();
+        }
+        pushed += count;
+      }
+      i += n;
+    }
+  });
+
+  std::vector<int> consumed;
+  while (consumed.size() < num_elements) {
+    if (queue.pop_bulk(std::back_inserter(consumed), batch) == 0) {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+
+  for (int i = 0; i < num_elements; ++i) {
+    ASSERT_EQ(consumed[i], i);
+  }
+}
+
+TEST(ScspLockFreeQueueTest, EmplaceAndInPlaceAccess) {
+  nyx::data_structure::ScspLockFreeQueue<std::pair<int, std::string>> queue(2);
+
+  EXPECT_EQ(queue.front(), nullptr);
+  EXPECT_TRUE(queue.try_emplace(1, "one"));
+
+  auto slot = queue.reserve();
+  ASSERT_NE(slot, nullptr);
+  new (slot) std::pair<int, std::string>(2, "two");
+  queue.commit();
+
+  EXPECT_FALSE(queue.try_emplace(3, "three"));  // Queue should be full now
+  EXPECT_EQ(queue.reserve(), nullptr);
+
+  auto head = queue.front();
+  ASSERT_NE(head, nullptr);
+  EXPECT_EQ(head->first, 1);
+  EXPECT_EQ(head->second, "one");
+  queue.consume();
+
+  head = queue.front();
+  ASSERT_NE(head, nullptr);
+  EXPECT_EQ(head->first, 2);
+  EXPECT_EQ(head->second, "two");
+  queue.consume();
+
+  EXPECT_EQ(queue.front(), nullptr);
+}
+
+TEST(ScspLockFreeQueueTest, PowerOfTwoCapacity) {
+  nyx::data_structure::ScspLockFreeQueue<int, std::allocator<int>, true> queue(4);
+
+  int value;
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_TRUE(queue.push(i));
+    EXPECT_TRUE(queue.try_emplace(i + 100));
+    EXPECT_TRUE(queue.pop(value));
+    EXPECT_EQ(value, i);
+    ASSERT_NE(queue.front(), nullptr);
+    EXPECT_EQ(*queue.front(), i + 100);
+    queue.consume();
+  }
+  EXPECT_EQ(queue.element(5), queue.element(1));
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "src/data_structure/scsp_unbounded_queue.hpp"
+
+using namespace nyx;
+
+TEST(ScspUnboundedQueueTest, BasicOperations) {
+  nyx::data_structure::ScspUnboundedQueue<int, 4> queue;
+
+  int value;
+  EXPECT_FALSE(queue.pop(value));
+  EXPECT_TRUE(queue.empty());
+
+  // Spans several segments
+  for (int i = 0; i < 10; ++i) {
+    queue.push(i);
+  }
+  EXPECT_EQ(queue.size(), 10);
+
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_TRUE(queue.pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(queue.pop(value));  // Queue should be empty now
+}
+
+TEST(ScspUnboundedQueueTest, ReusesDrainedSegments) {
+  nyx::data_structure::ScspUnboundedQueue<std::shared_ptr<int>, 2> queue(2);
+  auto counter = std::make_shared<int>(0);
+
+  std::shared_ptr<int> value;
+  for (int round = 0; round < 100; ++round) {
+    for (int i = 0; i < 5; ++i) {
+      queue.emplace(counter);
+    }
+    for (int i = 0; i < 5; ++i) {
+      ASSERT_TRUE(queue.pop(value));
+    }
+  }
+  value.reset();
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(ScspUnboundedQueueTest, DestroysRemainingElements) {
+  auto counter = std::make_shared<int>(0);
+  {
+    nyx::data_structure::ScspUnboundedQueue<std::shared_ptr<int>, 3> queue;
+    for (int i = 0; i < 7; ++i) {
+      queue.push(counter);
+    }
+    std::shared_ptr<int> value;
+    ASSERT_TRUE(queue.pop(value));
+    EXPECT_EQ(counter.use_count(), 8);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(ScspUnboundedQueueTest, MultiThread) {
+  const int num_elements = 200000;
+  nyx::data_structure::ScspUnboundedQueue<int, 64> queue;
+
+  std::thread producer([&]() {
+    for (int i = 0; i < num_elements; ++i) {
+      queue.push(i);
+    }
+  });
+
+  std::vector<int> consumed;
+  consumed.reserve(num_elements);
+  int value;
+  while (consumed.size() < num_elements) {
+    if (queue.pop(value)) {
+      consumed.push_back(value);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+
+  for (int i = 0; i < num_elements; ++i) {
+    ASSERT_EQ(consumed[i], i);
+  }
+}
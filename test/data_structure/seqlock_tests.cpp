@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "src/data_structure/seqlock.hpp"
+
+using namespace nyx::data_structure;
+
+namespace {
+// Odd size on purpose, the last word is partially used
+struct Snapshot {
+  std::uint64_t a;
+  std::uint64_t b;
+  std::uint64_t c;
+  std::uint8_t tag;
+};
+}  // namespace
+
+TEST(SeqlockTest, LoadReturnsLastStore) {
+  Seqlock<Snapshot> lock(Snapshot{1, 2, 3, 4});
+  auto value = lock.load();
+  EXPECT_EQ(value.a, 1);
+  EXPECT_EQ(value.tag, 4);
+  EXPECT_EQ(lock.version(), 0);
+
+  lock.store(Snapshot{5, 6, 7, 8});
+  value = lock.load();
+  EXPECT_EQ(value.b, 6);
+  EXPECT_EQ(value.tag, 8);
+  EXPECT_EQ(lock.version(), 2);
+
+  Snapshot attempt{};
+  EXPECT_TRUE(lock.try_load(&attempt));
+  EXPECT_EQ(attempt.c, 7);
+}
+
+TEST(SeqlockTest, UpdateModifiesInPlace) {
+  Seqlock<std::uint64_t> counter;
+  counter.update([](std::uint64_t& value) { value += 41; });
+  counter.update([](std::uint64_t& value) { ++value; });
+  EXPECT_EQ(counter.load(), 42);
+  EXPECT_EQ(counter.version(), 4);
+}
+
+TEST(SeqlockTest, ReadersNeverSeeTornValues) {
+  Seqlock<Snapshot> lock(Snapshot{0, 0, 0, 0});
+  std::atomic<bool> done{false};
+
+  std::vector<std::thread> readers;
+  std::atomic<std::uint64_t> torn{0};
+  for (int i = 0; i < 3; ++i) {
+    readers.emplace_back([&] {
+      while (!done.load(std::memory_order_relaxed)) {
+        auto value = lock.load();
+        torn += value.a != value.b || value.b != value.c || value.tag != static_cast<std::uint8_t>(value.a);
+      }
+    });
+  }
+
+  for (std::uint64_t i = 1; i <= 50'000; ++i) {
+    lock.store(Snapshot{i, i, i, static_cast<std::uint8_t>(i)});
+  }
+  done = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  EXPECT_EQ(torn, 0);
+}
+
+TEST(SeqlockTest, WritersExcludeEachOther) {
+  Seqlock<std::uint64_t> counter;
+  constexpr int kWriters = 4;
+  constexpr int kIncrements = 10'000;
+
+  std::vector<std::thread> writers;
+  for (int i = 0; i < kWriters; ++i) {
+    writers.emplace_back([&] {
+      for (int j = 0; j < kIncrements; ++j) {
+        counter.update([](std::uint64_t& value) { ++value; });
+      }
+    });
+  }
+  for (auto& writer : writers) {
+    writer.join();
+  }
+  EXPECT_EQ(counter.load(), kWriters * kIncrements);
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "src/data_structure/sharded_cache.hpp"
+
+using namespace nyx::data_structure;
+
+template <typename Policy>
+class ShardedCacheTest : public ::testing::Test {};
+
+using Policies = ::testing::Types<cache_policy::Lru, cache_policy::S3Fifo>;
+TYPED_TEST_SUITE(ShardedCacheTest, Policies);
+
+TYPED_TEST(ShardedCacheTest, GetPutErase) {
+  ShardedCache<int, std::string, TypeParam> cache(100, 4);
+
+  EXPECT_FALSE(cache.get(1).has_value());
+  EXPECT_TRUE(cache.put(1, "one"));
+  EXPECT_TRUE(cache.put(2, "two"));
+  EXPECT_EQ(cache.get(1), "one");
+
+  EXPECT_TRUE(cache.put(1, "uno"));
+  EXPECT_EQ(cache.get(1), "uno");
+  EXPECT_EQ(cache.size(), 2);
+
+  EXPECT_TRUE(cache.erase(1));
+  EXPECT_FALSE(cache.erase(1));
+  EXPECT_FALSE(cache.get(1).has_value());
+
+  auto stats = cache.stats();
+  EXPECT_EQ(stats.hits, 2);
+  EXPECT_EQ(stats.misses, 2);
+  EXPECT_EQ(stats.insertions, 3);
+  EXPECT_EQ(stats.evictions, 0);
+}
+
+TYPED_TEST(ShardedCacheTest, CapacityByCount) {
+  ShardedCache<int, int, TypeParam> cache(50, 1);
+  for (int i = 0; i < 1000; ++i) {
+    cache.put(i, i);
+    ASSERT_LE(cache.size(), 50);
+  }
+
+  EXPECT_EQ(cache.size(), 50);
+  EXPECT_EQ(cache.stats().evictions, 950);
+}
+
+TYPED_TEST(ShardedCacheTest, CapacityByBytes) {
+  ShardedCache<int, std::string, TypeParam, cache_weigher::Bytes> cache(100, 1);
+
+  EXPECT_TRUE(cache.put(1, std::string(60, 'a')));
+  EXPECT_TRUE(cache.put(2, std::string(30, 'b')));
+  EXPECT_EQ(cache.weight(), 90);
+
+  EXPECT_TRUE(cache.put(3, std::string(30, 'c')));
+  EXPECT_LE(cache.weight(), 100);
+  EXPECT_TRUE(cache.get(3).has_value());
+
+  // Heavier than the whole shard, not cached and drops the stale value
+  EXPECT_FALSE(cache.put(3, std::string(101, 'd')));
+  EXPECT_FALSE(cache.get(3).has_value());
+}
+
+TYPED_TEST(ShardedCacheTest, ConcurrentAccess) {
+  ShardedCache<int, int, TypeParam> cache(512, 8);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&cache, t] {
+      for (int i = 0; i < 20000; ++i) {
+        int key = (i * 7 + t) % 1024;
+        if (auto value = cache.get(key)) {
+          ASSERT_EQ(*value, key * 2);
+        } else {
+          cache.put(key, key * 2);
+        }
+        if (i % 97 == 0) {
+          cache.erase(key);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto stats = cache.stats();
+  EXPECT_EQ(stats.hits + stats.misses, 4 * 20000);
+  EXPECT_LE(cache.size(), cache.capacity());
+}
+
+TEST(ShardedCacheTest, LruEvictsLeastRecentlyUsed) {
+  ShardedCache<int, int, cache_policy::Lru> cache(3, 1);
+  cache.put(1, 1);
+  cache.put(2, 2);
+  cache.put(3, 3);
+  cache.get(1);
+  cache.put(4, 4);
+
+  EXPECT_TRUE(cache.get(1).has_value());
+  EXPECT_FALSE(cache.get(2).has_value());
+  EXPECT_TRUE(cache.get(3).has_value());
+  EXPECT_TRUE(cache.get(4).has_value());
+}
+
+TEST(ShardedCacheTest, S3FifoKeepsHotKeysThroughScan) {
+  ShardedCache<int, int, cache_policy::S3Fifo> cache(100, 1);
+
+  // Hot keys get a second access while they sit in the small queue and move to main
+  for (int round = 0; round < 2; ++round) {
+    for (int key = 0; key < 10; ++key) {
+      if (!cache.get(key)) {
+        cache.put(key, key);
+      }
+    }
+  }
+
+  // A one-hit scan larger than the cache only churns through the small queue
+  for (int key = 1000; key < 2000; ++key) {
+    cache.put(key, key);
+  }
+
+  for (int key = 0; key < 10; ++key) {
+    EXPECT_TRUE(cache.get(key).has_value()) << key;
+  }
+}
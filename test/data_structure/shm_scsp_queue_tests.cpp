@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include "src/data_structure/shm_scsp_queue.hpp"
+
+using namespace nyx::data_structure;
+
+namespace {
+struct Order {
+  std::uint64_t id;
+  double price;
+  std::uint32_t quantity;
+};
+
+std::string unique_name(const char* test) { return "/nyx-test-" + std::to_string(getpid()) + "-" + test; }
+}  // namespace
+
+TEST(ShmScspQueueTest, NamedQueueIsSharedBetweenMappings) {
+  auto name = unique_name("named");
+  auto producer = ShmScspQueue<Order>::create(name, 4);
+  ASSERT_NE(producer, nullptr) << std::strerror(errno);
+  auto consumer = ShmScspQueue<Order>::attach(name);
+  ASSERT_NE(consumer, nullptr) << std::strerror(errno);
+  EXPECT_EQ(consumer->capacity(), 4);
+
+  for (std::uint64_t i = 0; i < 4; ++i) {
+    EXPECT_TRUE(producer->push(Order{i, 1.5 * i, static_cast<std::uint32_t>(i * 10)}));
+  }
+  EXPECT_FALSE(producer->push(Order{}));
+
+  Order order;
+  for (std::uint64_t i = 0; i < 4; ++i) {
+    ASSERT_TRUE(consumer->pop(order));
+    EXPECT_EQ(order.id, i);
+    EXPECT_EQ(order.quantity, i * 10);
+  }
+  EXPECT_FALSE(consumer->pop(order));
+  EXPECT_TRUE(producer->empty());
+
+  EXPECT_TRUE(ShmScspQueue<Order>::unlink(name));
+}
+
+TEST(ShmScspQueueTest, RejectsMismatchedLayouts) {
+  auto name = unique_name("layout");
+  EXPECT_EQ(ShmScspQueue<Order>::create(name, 3), nullptr);
+  EXPECT_EQ(errno, EINVAL);
+
+  auto queue = ShmScspQueue<Order>::create(name, 8);
+  ASSERT_NE(queue, nullptr);
+  EXPECT_EQ(ShmScspQueue<Order>::create(name, 8), nullptr);
+  EXPECT_EQ(errno, EEXIST);
+
+  EXPECT_EQ(ShmScspQueue<std::uint32_t>::attach(name), nullptr) << "Element size differs";
+  EXPECT_EQ(errno, EINVAL);
+
+  ShmScspQueue<Order>::unlink(name);
+  EXPECT_EQ(ShmScspQueue<Order>::attach(name), nullptr);
+  EXPECT_EQ(errno, ENOENT);
+}
+
+TEST(ShmScspQueueTest, ZeroCopyReserveAndFront) {
+  auto producer = ShmScspQueue<Order>::create_anonymous(2);
+  ASSERT_NE(producer, nullptr);
+  auto consumer = ShmScspQueue<Order>::attach_fd(producer->fd());
+  ASSERT_NE(consumer, nullptr);
+
+  auto* slot = producer->reserve();
+  ASSERT_NE(slot, nullptr);
+  slot->id = 7;
+  EXPECT_EQ(consumer->front(), nullptr) << "Not committed yet";
+  producer->commit();
+
+  auto* front = consumer->front();
+  ASSERT_NE(front, nullptr);
+  EXPECT_EQ(front->id, 7);
+  consumer->consume();
+  EXPECT_EQ(consumer->front(), nullptr);
+}
+
+TEST(ShmScspQueueTest, CrossProcessRoundTrip) {
+  auto name = unique_name("fork");
+  auto queue = ShmScspQueue<Order>::create(name, 64);
+  ASSERT_NE(queue, nullptr);
+  constexpr std::uint64_t kOrders = 100'000;
+
+  auto child = fork();
+  ASSERT_GE(child, 0);
+  if (child == 0) {
+    // Separate mapping, like an unrelated producer process would have
+    auto producer = ShmScspQueue<Order>::attach(name);
+    if (producer == nullptr) {
+      _exit(1);
+    }
+    for (std::uint64_t i = 0; i < kOrders;) {
+      if (producer->push(Order{i, 0.5 * i, 1})) {
+        ++i;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+    _exit(0);
+  }
+
+  Order order;
+  std::uint64_t errors = 0;
+  for (std::uint64_t i = 0; i < kOrders;) {
+    if (queue->pop(order)) {
+      errors += order.id != i || order.price != 0.5 * i;
+      ++i;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+
+  int status = 0;
+  waitpid(child, &status, 0);
+  EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+  EXPECT_EQ(errors, 0);
+  ShmScspQueue<Order>::unlink(name);
+}
@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "src/data_structure/skiplist.hpp"
+#include "src/utils/include/rand.hpp"
+
+using nyx::data_structure::SkipListMap;
+using nyx::data_structure::SkipListSet;
+
+TEST(SkipListTest, InsertFindErase) {
+  SkipListMap<int, std::string> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.find(1), map.end());
+
+  EXPECT_TRUE(map.insert(1, "one"));
+  EXPECT_FALSE(map.insert(1, "uno"));
+  EXPECT_TRUE(map.insert(3, "three"));
+  ASSERT_NE(map.find(1), map.end());
+  EXPECT_EQ(map.find(1)->second, "one");
+  EXPECT_EQ(map.size(), 2);
+
+  EXPECT_TRUE(map.erase(1));
+  EXPECT_FALSE(map.erase(1));
+  EXPECT_FALSE(map.contains(1));
+  EXPECT_TRUE(map.contains(3));
+  EXPECT_EQ(map.size(), 1);
+}
+
+TEST(SkipListTest, IteratesInOrder) {
+  SkipListSet<int> set;
+  std::set<int> expected;
+  for (auto value : nyx::utils::rand::rand_list(10'000, 100'000)) {
+    EXPECT_EQ(set.insert(value), expected.insert(value).second);
+  }
+  for (auto value : nyx::utils::rand::rand_list(5'000, 100'000)) {
+    EXPECT_EQ(set.erase(value), expected.erase(value) == 1);
+  }
+
+  EXPECT_EQ(set.size(), expected.size());
+  EXPECT_TRUE(std::equal(set.begin(), set.end(), expected.begin(), expected.end()));
+}
+
+TEST(SkipListTest, BoundsFindNextKey) {
+  SkipListSet<int> set;
+  for (int value : {10, 20, 30}) {
+    set.insert(value);
+  }
+
+  EXPECT_EQ(*set.lower_bound(20), 20);
+  EXPECT_EQ(*set.upper_bound(20), 30);
+  EXPECT_EQ(*set.lower_bound(11), 20);
+  EXPECT_EQ(*set.upper_bound(5), 10);
+  EXPECT_EQ(set.upper_bound(30), set.end());
+
+  set.erase(20);
+  EXPECT_EQ(*set.upper_bound(10), 30);
+
+  // Range scan [15, 35)
+  std::vector<int> range;
+  for (auto it = set.lower_bound(15); it != set.end() && *it < 35; ++it) {
+    range.push_back(*it);
+  }
+  EXPECT_EQ(range, std::vector<int>({30}));
+}
+
+TEST(SkipListTest, ConcurrentInsertEraseKeepsOrder) {
+  SkipListSet<int> set;
+  constexpr int kThreads = 4;
+  constexpr int kKeys = 20'000;
+
+  // Every thread inserts all keys of its residue and erases the odd ones, other threads race on the same keys
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (int round = 0; round < 2; ++round) {
+        for (int key = (t + round) % kThreads; key < kKeys; key += kThreads) {
+          set.insert(key);
+          if (key % 2 == 1) {
+            set.erase(key);
+          }
+        }
+      }
+    });
+  }
+
+  std::atomic<bool> done{false};
+  std::thread reader([&] {
+    while (!done.load(std::memory_order_acquire)) {
+      int previous = -1;
+      for (int key : set) {
+        ASSERT_LT(previous, key);
+        previous = key;
+      }
+    }
+  });
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  done.store(true, std::memory_order_release);
+  reader.join();
+
+  EXPECT_EQ(set.size(), kKeys / 2);
+  int expected = 0;
+  for (int key : set) {
+    ASSERT_EQ(key, expected);
+    expected += 2;
+  }
+  EXPECT_EQ(expected, kKeys);
+}
+
+TEST(SkipListTest, ConcurrentEraseOwnedByOneThread) {
+  SkipListSet<int> set;
+  constexpr int kKeys = 10'000;
+  for (int key = 0; key < kKeys; ++key) {
+    set.insert(key);
+  }
+
+  std::atomic<int> erased{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&] {
+      for (int key = 0; key < kKeys; ++key) {
+        erased.fetch_add(set.erase(key));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(erased.load(), kKeys);
+  EXPECT_TRUE(set.empty());
+  EXPECT_EQ(set.size(), 0);
+}
+
+TEST(SkipListTest, IterateWhileErasing) {
+  SkipListSet<int> set;
+  constexpr int kKeys = 2;
+  constexpr int kRounds = 50'000;
+
+  // Writers keep retiring the first nodes that begin() and empty() walk through
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([&, t] {
+      for (int round = 0; round < kRounds; ++round) {
+        auto key = round % kKeys;
+        if (t % 2 == 0) {
+          set.insert(key);
+        } else {
+          set.erase(key);
+        }
+
+        int previous = -1;
+        for (int seen : set) {
+          ASSERT_GT(seen, previous);
+          ASSERT_LT(seen, kKeys);
+          previous = seen;
+        }
+        set.empty();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_LE(set.size(), kKeys);
+}
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "src/data_structure/slot_index.hpp"
+
+using nyx::data_structure::SlotIndex;
+
+TEST(SlotIndexTest, FindInsertErase) {
+  SlotIndex index;
+  // Slot i holds the value values[i]
+  std::vector<int> values;
+  for (int i = 0; i < 1000; ++i) {
+    values.push_back(i * 7);
+  }
+
+  auto find = [&index, &values](int value) {
+    return index.find(SlotIndex::spread(value), [&values, value](std::uint32_t slot) { return values[slot] == value; });
+  };
+
+  index.reserve(values.size());
+  for (std::uint32_t slot = 0; slot < values.size(); ++slot) {
+    index.insert(slot, SlotIndex::spread(values[slot]));
+  }
+  for (std::uint32_t slot = 0; slot < values.size(); ++slot) {
+    ASSERT_EQ(find(values[slot]), slot);
+  }
+  ASSERT_EQ(find(1), SlotIndex::npos);
+
+  // Erasing every other slot must keep the rest of each cluster reachable
+  for (std::uint32_t slot = 0; slot < values.size(); slot += 2) {
+    index.erase(slot, SlotIndex::spread(values[slot]));
+  }
+  for (std::uint32_t slot = 0; slot < values.size(); ++slot) {
+    ASSERT_EQ(find(values[slot]), slot % 2 ? slot : SlotIndex::npos);
+  }
+
+  index.clear();
+  ASSERT_EQ(find(values[1]), SlotIndex::npos);
+}
+
+TEST(SlotIndexTest, SameHashComparesElements) {
+  SlotIndex index;
+  std::vector<int> values{1, 2, 3};
+
+  // Every entry lands in the same cluster
+  for (std::uint32_t slot = 0; slot < values.size(); ++slot) {
+    index.insert(slot, 42);
+  }
+  for (std::uint32_t slot = 0; slot < values.size(); ++slot) {
+    ASSERT_EQ(index.find(42, [&values, &slot](std::uint32_t other) { return values[other] == values[slot]; }), slot);
+  }
+
+  index.erase(0, 42);
+  ASSERT_EQ(index.find(42, [&values](std::uint32_t slot) { return values[slot] == 3; }), 2u);
+  ASSERT_EQ(index.find(42, [&values](std::uint32_t slot) { return values[slot] == 1; }), SlotIndex::npos);
+}
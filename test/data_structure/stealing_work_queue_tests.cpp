@@ -1,5 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
 #include "src/data_structure/stealing_work_queue.hpp"
 
 using namespace nyx;
@@ -15,7 +22,7 @@ class StealingWorkQueueTest : public ::testing::Test {
   }
 
   // Create a StealingWorkQueue instance for testing
-  nyx::data_structure::StealingWorkQueue<int> queue;
+  nyx::data_structure::StealingWorkQueue<int> queue{64};
 };
 
 TEST_F(StealingWorkQueueTest, InitializationTest) {
@@ -37,78 +44,211 @@ TEST_F(StealingWorkQueueTest, PushAndPopTest) {
   auto value2 = queue.pop();
   ASSERT_TRUE(value2.has_value());
   EXPECT_EQ(value2.value(), 2);
-  //
-  // value = queue.pop();
-  // ASSERT_TRUE(value.has_value());
-  // EXPECT_EQ(value.value(), 3);
-  //
-  // EXPECT_TRUE(queue.empty());
+
+  value = queue.pop();
+  ASSERT_TRUE(value.has_value());
+  EXPECT_EQ(value.value(), 1);
+
+  EXPECT_TRUE(queue.empty());
+  EXPECT_FALSE(queue.pop().has_value());
 }
 
-// TEST_F(StealingWorkQueueTest, StealTest) {
-//   queue.push(1);
-//   queue.push(2);
-//   queue.push(3);
-//
-//   std::optional<int> stolen_value;
-//   std::thread thief([&stolen_value, ] { stolen_value = queue.steal(); });
-//
-//   thief.join();
-//
-//   ASSERT_TRUE(stolen_value.has_value());
-//   EXPECT_EQ(stolen_value.value(), 1);  // Steal from the front of the queue
-//
-//   EXPECT_EQ(queue.size(), 2);
-//
-//   auto value = queue.pop();
-//   ASSERT_TRUE(value.has_value());
-//   EXPECT_EQ(value.value(), 3);
-//
-//   value = queue.pop();
-//   ASSERT_TRUE(value.has_value());
-//   EXPECT_EQ(value.value(), 2);
-//
-//   EXPECT_TRUE(queue.empty());
-// }
-//
-// TEST_F(StealingWorkQueueTest, ConcurrentPushAndPop) {
-//   const int num_elements = 1000;
-//   std::thread producer([&queue, num_elements] {
-//     for (int i = 0; i < num_elements; ++i) {
-//       queue.push(i);
-//     }
-//   });
-//
-//   std::thread consumer([&queue, num_elements] {
-//     for (int i = 0; i < num_elements; ++i) {
-//       while (queue.pop() == std::nullopt) {
-//         std::this_thread::yield();
-//       }
-//     }
-//   });
-//
-//   producer.join();
-//   consumer.join();
-//
-//   EXPECT_TRUE(queue.empty());
-// }
-//
-// TEST_F(StealingWorkQueueTest, ResizeTest) {
-//   const int initial_capacity = queue.capacity();
-//   for (int i = 0; i < initial_capacity; ++i) {
-//     queue.push(i);
-//   }
-//
-//   queue.push(initial_capacity);  // This should trigger a resize
-//
-//   EXPECT_GT(queue.capacity(), initial_capacity);
-//   EXPECT_EQ(queue.size(), initial_capacity + 1);
-//
-//   for (int i = initial_capacity; i >= 0; --i) {
-//     auto value = queue.pop();
-//     ASSERT_TRUE(value.has_value());
-//     EXPECT_EQ(value.value(), i);
-//   }
-//
-//   EXPECT_TRUE(queue.empty());
-// }
+TEST_F(StealingWorkQueueTest, StealTest) {
+  queue.push(1);
+  queue.push(2);
+  queue.push(3);
+
+  std::optional<int> stolen_value;
+  std::thread thief([this, &stolen_value] { stolen_value = queue.steal(); });
+
+  thief.join();
+
+  ASSERT_TRUE(stolen_value.has_value());
+  EXPECT_EQ(stolen_value.value(), 1);  // Steal from the front of the queue
+
+  EXPECT_EQ(queue.size(), 2);
+
+  auto value = queue.pop();
+  ASSERT_TRUE(value.has_value());
+  EXPECT_EQ(value.value(), 3);
+
+  value = queue.pop();
+  ASSERT_TRUE(value.has_value());
+  EXPECT_EQ(value.value(), 2);
+
+  EXPECT_TRUE(queue.empty());
+  EXPECT_FALSE(queue.steal().has_value());
+}
+
+TEST_F(StealingWorkQueueTest, ResizeTest) {
+  const int initial_capacity = queue.capacity();
+  for (int i = 0; i < initial_capacity; ++i) {
+    queue.push(std::move(i));
+  }
+
+  queue.push(int{initial_capacity});  // This should trigger a resize
+
+  EXPECT_GT(queue.capacity(), initial_capacity);
+  EXPECT_EQ(queue.size(), initial_capacity + 1);
+
+  EXPECT_EQ(queue.steal().value(), 0);
+  for (int i = initial_capacity; i >= 1; --i) {
+    auto value = queue.pop();
+    ASSERT_TRUE(value.has_value());
+    EXPECT_EQ(value.value(), i);
+  }
+
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(StealingWorkQueueTest, OwnsMoveOnlyItems) {
+  nyx::data_structure::StealingWorkQueue<std::unique_ptr<int>> boxes(2);
+  boxes.push(std::make_unique<int>(1));
+  boxes.push(std::make_unique<int>(2));
+  boxes.push(std::make_unique<int>(3));
+
+  EXPECT_EQ(*boxes.steal().value(), 1);
+  EXPECT_EQ(*boxes.pop().value(), 3);
+  // Remaining item is released by the destructor
+}
+
+TEST_F(StealingWorkQueueTest, ConcurrentPopAndSteal) {
+  const int num_elements = 100000;
+  const int num_thieves = 3;
+
+  std::atomic<bool> done{false};
+  std::vector<std::vector<int>> stolen(num_thieves);
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < num_thieves; ++t) {
+    thieves.emplace_back([this, t, &done, &stolen] {
+      while (!done.load(std::memory_order_acquire) || !queue.empty()) {
+        if (auto value = queue.steal()) {
+          stolen[t].push_back(*value);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  // Owner grows the deque while thieves are reading it
+  std::vector<int> popped;
+  for (int i = 0; i < num_elements; ++i) {
+    int value = i;
+    queue.push(std::move(value));
+    if (i % 3 == 0) {
+      if (auto value = queue.pop()) {
+        popped.push_back(*value);
+      }
+    }
+  }
+  while (auto value = queue.pop()) {
+    popped.push_back(*value);
+  }
+  done.store(true, std::memory_order_release);
+
+  for (auto& thief : thieves) {
+    thief.join();
+  }
+
+  std::vector<int> all(popped);
+  for (auto& part : stolen) {
+    all.insert(all.end(), part.begin(), part.end());
+  }
+  ASSERT_EQ(all.size(), num_elements);
+  std::sort(all.begin(), all.end());
+  for (int i = 0; i < num_elements; ++i) {
+    ASSERT_EQ(all[i], i);
+  }
+}
+
+TEST_F(StealingWorkQueueTest, StealBatchTakesHalf) {
+  for (int i = 0; i < 9; ++i) {
+    queue.push(int{i});
+  }
+
+  nyx::data_structure::StealingWorkQueue<int> thief_queue{64};
+  EXPECT_EQ(queue.steal_batch(thief_queue), 5);
+  EXPECT_EQ(queue.size(), 4);
+  EXPECT_EQ(thief_queue.size(), 5);
+
+  // Oldest items end up in the thief's deque in the same order
+  EXPECT_EQ(thief_queue.steal().value(), 0);
+  EXPECT_EQ(thief_queue.pop().value(), 4);
+
+  EXPECT_EQ(queue.steal_batch(thief_queue, 1), 1);
+  EXPECT_EQ(thief_queue.pop().value(), 5);
+  EXPECT_EQ(queue.pop().value(), 8);
+  EXPECT_EQ(queue.pop().value(), 7);
+  EXPECT_EQ(queue.pop().value(), 6);
+  EXPECT_FALSE(queue.pop().has_value());
+  EXPECT_EQ(queue.steal_batch(thief_queue), 0);
+}
+
+TEST_F(StealingWorkQueueTest, StealBatchGrowsThiefDeque) {
+  for (int i = 0; i < 200; ++i) {
+    queue.push(int{i});
+  }
+
+  nyx::data_structure::StealingWorkQueue<int> thief_queue{64};
+  thief_queue.push(-1);
+  EXPECT_EQ(queue.steal_batch(thief_queue), 100);
+  EXPECT_GE(thief_queue.capacity(), 101);
+  EXPECT_EQ(thief_queue.size(), 101);
+
+  for (int i = 99; i >= 0; --i) {
+    EXPECT_EQ(thief_queue.pop().value(), i);
+  }
+  EXPECT_EQ(thief_queue.pop().value(), -1);
+}
+
+TEST_F(StealingWorkQueueTest, ConcurrentPopAndStealBatch) {
+  const int num_elements = 100000;
+  const int num_thieves = 3;
+
+  std::atomic<bool> done{false};
+  std::vector<std::vector<int>> stolen(num_thieves);
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < num_thieves; ++t) {
+    thieves.emplace_back([this, t, &done, &stolen] {
+      nyx::data_structure::StealingWorkQueue<int> own{64};
+      while (!done.load(std::memory_order_acquire) || !queue.empty()) {
+        if (queue.steal_batch(own, 32) == 0) {
+          std::this_thread::yield();
+        }
+        while (auto value = own.pop()) {
+          stolen[t].push_back(*value);
+        }
+      }
+    });
+  }
+
+  std::vector<int> popped;
+  for (int i = 0; i < num_elements; ++i) {
+    int value = i;
+    queue.push(std::move(value));
+    if (i % 3 == 0) {
+      if (auto value = queue.pop()) {
+        popped.push_back(*value);
+      }
+    }
+  }
+  while (auto value = queue.pop()) {
+    popped.push_back(*value);
+  }
+  done.store(true, std::memory_order_release);
+
+  for (auto& thief : thieves) {
+    thief.join();
+  }
+
+  std::vector<int> all(popped);
+  for (auto& part : stolen) {
+    all.insert(all.end(), part.begin(), part.end());
+  }
+  ASSERT_EQ(all.size(), num_elements);
+  std::sort(all.begin(), all.end());
+  for (int i = 0; i < num_elements; ++i) {
+    ASSERT_EQ(all[i], i);
+  }
+}
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "src/data_structure/timing_wheel.hpp"
+
+using namespace nyx::data_structure;
+
+using Tick = std::uint64_t;
+
+TEST(TimingWheelTest, TimersFireOnTheirTick) {
+  TimingWheel<int> wheel;
+  const std::vector<Tick> delays{1, 5, 63, 64, 65, 4095, 4096, 300'000};
+  for (std::size_t i = 0; i < delays.size(); ++i) {
+    wheel.schedule(delays[i], static_cast<int>(i));
+  }
+  EXPECT_EQ(wheel.size(), delays.size());
+
+  std::vector<std::pair<Tick, int>> fired;
+  wheel.advance(1'000'000, [&](int value) { fired.emplace_back(wheel.now(), value); });
+
+  ASSERT_EQ(fired.size(), delays.size());
+  for (std::size_t i = 0; i < delays.size(); ++i) {
+    EXPECT_EQ(fired[i], std::make_pair(delays[i], static_cast<int>(i)));
+  }
+  EXPECT_TRUE(wheel.empty());
+  EXPECT_EQ(wheel.now(), 1'000'000);
+  EXPECT_EQ(wheel.next_tick(), TimingWheel<int>::kNever);
+}
+
+TEST(TimingWheelTest, ZeroDelayFiresOnNextTick) {
+  TimingWheel<int> wheel(100);
+  wheel.schedule(0, 1);
+  EXPECT_EQ(wheel.next_tick(), 101);
+  EXPECT_EQ(wheel.advance(100, [](int) {}), 0);
+  EXPECT_EQ(wheel.advance(101, [](int) {}), 1);
+}
+
+TEST(TimingWheelTest, CancelIsOneShot) {
+  TimingWheel<int> wheel;
+  auto first = wheel.schedule(10, 1);
+  auto second = wheel.schedule(10, 2);
+
+  EXPECT_TRUE(wheel.cancel(first));
+  EXPECT_FALSE(wheel.cancel(first));
+  EXPECT_EQ(wheel.size(), 1);
+
+  // The node of the cancelled timer is reused, its old id must not cancel the new timer
+  auto third = wheel.schedule(20, 3);
+  EXPECT_EQ(third.node, first.node);
+  EXPECT_FALSE(wheel.cancel(first));
+
+  std::vector<int> fired;
+  wheel.advance(100, [&](int value) { fired.push_back(value); });
+  EXPECT_EQ(fired, std::vector<int>({2, 3}));
+  EXPECT_FALSE(wheel.cancel(second)) << "Already fired";
+}
+
+TEST(TimingWheelTest, NextTickSkipsEmptyTicks) {
+  TimingWheel<int> wheel;
+  wheel.schedule(1'000'000, 1);
+
+  // Every hop is a cascade towards the expiry, a handful instead of a million
+  std::size_t hops = 0;
+  std::size_t fired = 0;
+  for (auto tick = wheel.next_tick(); tick != TimingWheel<int>::kNever; tick = wheel.next_tick()) {
+    ++hops;
+    fired += wheel.advance(tick, [](int) {});
+  }
+  EXPECT_EQ(fired, 1);
+  EXPECT_EQ(wheel.now(), 1'000'000);
+  EXPECT_LE(hops, 6);
+}
+
+TEST(TimingWheelTest, TimersBeyondTheTopLevelWaitForTheirRevolution) {
+  // Two levels span 4096 ticks
+  TimingWheel<int, 2> wheel(4000);
+  wheel.schedule(100'000, 1);
+  wheel.schedule(9'000, 2);
+
+  std::vector<std::pair<Tick, int>> fired;
+  wheel.advance(200'000, [&](int value) { fired.emplace_back(wheel.now(), value); });
+  EXPECT_EQ(fired, (std::vector<std::pair<Tick, int>>{{13'000, 2}, {104'000, 1}}));
+}
+
+TEST(TimingWheelTest, ExpiryCallbackCanReschedule) {
+  TimingWheel<int> wheel;
+  std::vector<Tick> fired;
+  wheel.schedule(100, 0);
+
+  wheel.advance(1'000, [&](int) {
+    fired.push_back(wheel.now());
+    wheel.schedule(100, 0);
+  });
+  EXPECT_EQ(fired, std::vector<Tick>({100, 200, 300, 400, 500, 600, 700, 800, 900, 1000}));
+  EXPECT_EQ(wheel.size(), 1);
+}
+
+TEST(TimingWheelTest, MatchesReferenceUnderRandomOperations) {
+  using Wheel = TimingWheel<int, 3>;
+  struct Pending {
+    Wheel::TimerId id;
+    Tick expiry;
+    int value;
+  };
+
+  Wheel wheel;
+  std::multimap<Tick, int> reference;
+  std::vector<Pending> pending;
+  std::mt19937_64 rng(42);
+
+  int next_value = 0;
+  for (int round = 0; round < 20'000; ++round) {
+    auto op = rng() % 10;
+    if (op < 5) {
+      // Spans every level and goes beyond the 2^18 ticks three levels cover
+      Tick delay = 1 + rng() % (Tick{1} << (rng() % 20));
+      pending.push_back(Pending{wheel.schedule(delay, next_value), wheel.now() + delay, next_value});
+      reference.emplace(wheel.now() + delay, next_value++);
+    } else if (op < 7 && !pending.empty()) {
+      auto index = rng() % pending.size();
+      auto timer = pending[index];
+      pending.erase(pending.begin() + index);
+      if (wheel.cancel(timer.id)) {
+        auto [first, last] = reference.equal_range(timer.expiry);
+        auto it = std::find_if(first, last, [&](const auto& entry) { return entry.second == timer.value; });
+        ASSERT_NE(it, last) << "Cancelled a timer that already fired";
+        reference.erase(it);
+      }
+    } else {
+      auto target = wheel.now() + rng() % 50'000;
+      std::vector<std::pair<Tick, int>> fired;
+      wheel.advance(target, [&](int value) { fired.emplace_back(wheel.now(), value); });
+
+      std::vector<std::pair<Tick, int>> expected;
+      while (!reference.empty() && reference.begin()->first <= target) {
+        expected.push_back(*reference.begin());
+        reference.erase(reference.begin());
+      }
+      ASSERT_TRUE(std::is_sorted(fired.begin(), fired.end(), [](const auto& a, const auto& b) { return a.first < b.first; }));
+      std::sort(fired.begin(), fired.end());
+      std::sort(expected.begin(), expected.end());
+      ASSERT_EQ(fired, expected);
+    }
+    ASSERT_EQ(wheel.size(), reference.size());
+  }
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include "src/data_structure/triple_buffer.hpp"
+
+using namespace nyx::data_structure;
+
+namespace {
+struct Health {
+  std::uint64_t sequence{0};
+  std::uint64_t checksum{0};
+};
+}  // namespace
+
+TEST(TripleBufferTest, ConsumerSeesInitialValue) {
+  TripleBuffer<std::string> buffer("boot");
+  EXPECT_FALSE(buffer.has_update());
+  EXPECT_FALSE(buffer.update());
+  EXPECT_EQ(buffer.read(), "boot");
+}
+
+TEST(TripleBufferTest, ConsumerOnlySeesNewestValue) {
+  TripleBuffer<int> buffer;
+  buffer.write(1);
+  buffer.write(2);
+  buffer.write(3);
+
+  EXPECT_TRUE(buffer.has_update());
+  EXPECT_EQ(buffer.read(), 3);
+  EXPECT_FALSE(buffer.update()) << "Intermediate values are dropped";
+  EXPECT_EQ(buffer.read(), 3);
+
+  buffer.write_buffer() = 4;
+  EXPECT_FALSE(buffer.has_update()) << "Not published yet";
+  buffer.publish();
+  EXPECT_EQ(buffer.read(), 4);
+}
+
+TEST(TripleBufferTest, ReadBufferIsStableUntilUpdate) {
+  TripleBuffer<int> buffer;
+  buffer.write(1);
+  ASSERT_TRUE(buffer.update());
+  const int& held = buffer.read_buffer();
+
+  for (int i = 2; i < 10; ++i) {
+    buffer.write(i);
+  }
+  EXPECT_EQ(held, 1);
+  EXPECT_EQ(buffer.read(), 9);
+}
+
+TEST(TripleBufferTest, ConcurrentReadsAreCompleteAndMonotonic) {
+  TripleBuffer<Health> buffer;
+  constexpr std::uint64_t kUpdates = 200'000;
+
+  std::thread producer([&] {
+    for (std::uint64_t i = 1; i <= kUpdates; ++i) {
+      auto& health = buffer.write_buffer();
+      health.sequence = i;
+      health.checksum = i * 31;
+      buffer.publish();
+    }
+  });
+
+  std::uint64_t last = 0, errors = 0;
+  while (last < kUpdates) {
+    const auto& health = buffer.read();
+    errors += health.checksum != health.sequence * 31 || health.sequence < last;
+    last = health.sequence;
+  }
+  producer.join();
+  EXPECT_EQ(errors, 0);
+}
@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <thread>
+
+#include "src/journal/include/journal.hpp"
+
+using nyx::journal::Journal;
+using nyx::journal::Options;
+
+namespace {
+class JournalTest : public ::testing::Test {
+ protected:
+  std::string directory_;
+
+  void SetUp() override {
+    auto name = std::string("nyx-journal-") + ::testing::UnitTest::GetInstance()->current_test_info()->name() + "-" + std::to_string(getpid());
+    directory_ = (std::filesystem::temp_directory_path() / name).string();
+    std::filesystem::remove_all(directory_);
+  }
+
+  void TearDown() override { std::filesystem::remove_all(directory_); }
+
+  std::size_t segment_files() const {
+    std::size_t count = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(directory_)) {
+      count += entry.path().extension() == ".seg";
+    }
+    return count;
+  }
+};
+
+std::string record(int i) { return "record-" + std::to_string(i) + std::string(i % 97, 'x'); }
+}  // namespace
+
+TEST_F(JournalTest, AppendThenConsumeInOrder) {
+  auto journal = Journal::open(directory_);
+  ASSERT_NE(journal, nullptr) << std::strerror(errno);
+  EXPECT_FALSE(journal->front().has_value());
+
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_TRUE(journal->append(record(i)));
+  }
+  auto* payload = journal->reserve(5);
+  ASSERT_NE(payload, nullptr);
+  std::memcpy(payload, "hello", 5);
+  journal->commit();
+
+  std::string value;
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_TRUE(journal->pop(value));
+    EXPECT_EQ(value, record(i));
+  }
+  EXPECT_EQ(journal->front(), std::optional<std::string_view>("hello"));
+  journal->consume();
+  EXPECT_FALSE(journal->pop(value));
+  EXPECT_EQ(journal->consumed(), journal->appended());
+}
+
+TEST_F(JournalTest, RecordsRollOverSegments) {
+  auto journal = Journal::open(directory_, Options{.segment_size = 4096});
+  ASSERT_NE(journal, nullptr);
+  EXPECT_EQ(journal->segment_size(), 4096);
+
+  EXPECT_FALSE(journal->append(std::string(journal->max_record_size() + 1, 'a')));
+  EXPECT_EQ(errno, EMSGSIZE);
+  ASSERT_TRUE(journal->append(std::string(journal->max_record_size(), 'a')));
+
+  // 1000 byte records leave a tail in every segment that has to be skipped
+  for (int i = 0; i < 20; ++i) {
+    ASSERT_TRUE(journal->append(std::string(1000, static_cast<char>('a' + i))));
+  }
+  EXPECT_GT(segment_files(), 5);
+
+  std::string value;
+  ASSERT_TRUE(journal->pop(value));
+  EXPECT_EQ(value.size(), journal->max_record_size());
+  for (int i = 0; i < 20; ++i) {
+    ASSERT_TRUE(journal->pop(value));
+    EXPECT_EQ(value, std::string(1000, static_cast<char>('a' + i)));
+  }
+
+  // Consumed segments are deleted once checkpointed, the flusher does it within a few intervals. What is
+  // left is the segment both cursors are in and the one mapped ahead of the producer.
+  journal->flush();
+  for (int i = 0; i < 200 && segment_files() > 2; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  EXPECT_EQ(segment_files(), 2);
+}
+
+TEST_F(JournalTest, ReopenResumesFromCheckpoint) {
+  {
+    auto journal = Journal::open(directory_, Options{.segment_size = 4096});
+    ASSERT_NE(journal, nullptr);
+    for (int i = 0; i < 50; ++i) {
+      ASSERT_TRUE(journal->append(record(i)));
+    }
+    std::string value;
+    for (int i = 0; i < 20; ++i) {
+      ASSERT_TRUE(journal->pop(value));
+    }
+  }
+
+  // The segment size of the existing files wins over the requested one
+  auto journal = Journal::open(directory_, Options{.segment_size = 1 << 20});
+  ASSERT_NE(journal, nullptr);
+  EXPECT_EQ(journal->segment_size(), 4096);
+  ASSERT_TRUE(journal->append(record(50)));
+
+  std::string value;
+  for (int i = 20; i <= 50; ++i) {
+    ASSERT_TRUE(journal->pop(value));
+    EXPECT_EQ(value, record(i));
+  }
+  EXPECT_FALSE(journal->pop(value));
+}
+
+TEST_F(JournalTest, AppendedRecordsSurviveProcessCrash) {
+  auto child = fork();
+  ASSERT_GE(child, 0);
+  if (child == 0) {
+    auto journal = Journal::open(directory_, Options{.segment_size = 8192, .flush_interval = std::chrono::hours(1)});
+    for (int i = 0; i < 300; ++i) {
+      if (journal == nullptr || !journal->append(record(i))) {
+        _exit(1);
+      }
+    }
+    // No flush, no destructor
+    _exit(0);
+  }
+  int status = 0;
+  waitpid(child, &status, 0);
+  ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+  auto journal = Journal::open(directory_);
+  ASSERT_NE(journal, nullptr);
+  std::string value;
+  for (int i = 0; i < 300; ++i) {
+    ASSERT_TRUE(journal->pop(value));
+    EXPECT_EQ(value, record(i));
+  }
+  EXPECT_FALSE(journal->pop(value));
+}
+
+TEST_F(JournalTest, ConcurrentProducerAndConsumer) {
+  auto journal = Journal::open(directory_, Options{.segment_size = 16384, .flush_interval = std::chrono::milliseconds(1)});
+  ASSERT_NE(journal, nullptr);
+  constexpr int kRecords = 20'000;
+
+  std::thread producer([&] {
+    for (int i = 0; i < kRecords; ++i) {
+      ASSERT_TRUE(journal->append(record(i)));
+    }
+  });
+
+  std::string value;
+  int errors = 0;
+  for (int i = 0; i < kRecords;) {
+    if (journal->pop(value)) {
+      errors += value != record(i++);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  EXPECT_EQ(errors, 0);
+
+  journal->flush();
+  EXPECT_EQ(journal->durable(), journal->appended());
+}
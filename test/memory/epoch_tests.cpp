@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "src/memory/include/epoch.hpp"
+
+namespace epoch = nyx::memory::epoch;
+
+namespace {
+struct Tracked {
+  static std::atomic<int> alive;
+  int value;
+
+  explicit Tracked(int value) : value(value) { alive.fetch_add(1); }
+  ~Tracked() { alive.fetch_sub(1); }
+};
+
+std::atomic<int> Tracked::alive{0};
+
+void drain() {
+  for (int i = 0; i < 4 && epoch::pending() != 0; ++i) {
+    epoch::collect();
+  }
+}
+}  // namespace
+
+TEST(EpochTest, PinIsReentrant) {
+  EXPECT_FALSE(epoch::is_pinned());
+  {
+    epoch::Guard outer;
+    EXPECT_TRUE(epoch::is_pinned());
+    {
+      epoch::Guard inner;
+      EXPECT_TRUE(epoch::is_pinned());
+    }
+    EXPECT_TRUE(epoch::is_pinned());
+  }
+  EXPECT_FALSE(epoch::is_pinned());
+}
+
+TEST(EpochTest, RetiredObjectsAreFreedAfterTwoEpochs) {
+  drain();
+  ASSERT_EQ(epoch::pending(), 0);
+
+  epoch::retire(new Tracked(1));
+  EXPECT_EQ(epoch::pending(), 1);
+  EXPECT_EQ(Tracked::alive.load(), 1);
+
+  drain();
+  EXPECT_EQ(epoch::pending(), 0);
+  EXPECT_EQ(Tracked::alive.load(), 0);
+}
+
+TEST(EpochTest, PinnedReaderBlocksReclamation) {
+  drain();
+
+  std::atomic<bool> pinned{false}, release{false};
+  std::thread reader([&]() {
+    epoch::Guard guard;
+    pinned.store(true);
+    while (!release.load()) {
+      std::this_thread::yield();
+    }
+  });
+
+  while (!pinned.load()) {
+    std::this_thread::yield();
+  }
+
+  epoch::retire(new Tracked(2));
+  for (int i = 0; i < 8; ++i) {
+    epoch::collect();
+  }
+  // The reader pinned an epoch that may still see the object
+  EXPECT_EQ(epoch::pending(), 1);
+  EXPECT_EQ(Tracked::alive.load(), 1);
+
+  release.store(true);
+  reader.join();
+
+  drain();
+  EXPECT_EQ(epoch::pending(), 0);
+  EXPECT_EQ(Tracked::alive.load(), 0);
+}
+
+TEST(EpochTest, ConcurrentReadersAndWriter) {
+  const int num_readers = 3;
+  const int num_updates = 20000;
+
+  std::atomic<Tracked*> shared{new Tracked(0)};
+  std::atomic<bool> done{false};
+
+  std::vector<std::thread> readers;
+  for (int r = 0; r < num_readers; ++r) {
+    readers.emplace_back([&]() {
+      int last = 0;
+      while (!done.load(std::memory_order_acquire)) {
+        epoch::Guard guard;
+        auto value = shared.load(std::memory_order_acquire)->value;
+        EXPECT_GE(value, last);
+        last = value;
+      }
+    });
+  }
+
+  for (int i = 1; i <= num_updates; ++i) {
+    auto old = shared.exchange(new Tracked(i), std::memory_order_acq_rel);
+    epoch::retire(old);
+  }
+  done.store(true, std::memory_order_release);
+
+  for (auto& reader : readers) {
+    reader.join();
+  }
+
+  drain();
+  delete shared.load();
+  EXPECT_EQ(Tracked::alive.load(), 0);
+}
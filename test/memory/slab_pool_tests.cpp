@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "src/memory/include/slab_pool.hpp"
+
+using nyx::memory::SlabAllocator;
+using nyx::memory::SlabPool;
+
+TEST(SlabPoolTest, FreedBlockIsReused) {
+  auto* first = SlabPool::allocate(40);
+  SlabPool::deallocate(first, 40);
+
+  // Same size class
+  auto* second = SlabPool::allocate(48);
+  EXPECT_EQ(second, first);
+  SlabPool::deallocate(second, 48);
+}
+
+TEST(SlabPoolTest, BlocksAreAlignedAndDistinct) {
+  for (std::size_t size : {std::size_t{1}, std::size_t{16}, std::size_t{100}, SlabPool::kMaxSize, SlabPool::kMaxSize + 1}) {
+    std::vector<void*> blocks;
+    for (int i = 0; i < 1000; ++i) {
+      auto* block = SlabPool::allocate(size);
+      ASSERT_EQ(reinterpret_cast<std::uintptr_t>(block) % SlabPool::kGranularity, 0);
+      std::memset(block, i & 0xff, size);
+      blocks.push_back(block);
+    }
+    for (int i = 0; i < 1000; ++i) {
+      ASSERT_EQ(*static_cast<unsigned char*>(blocks[i]), i & 0xff) << "Blocks overlap";
+      SlabPool::deallocate(blocks[i], size);
+    }
+  }
+}
+
+TEST(SlabPoolTest, BlocksFreedOnAnotherThreadComeBack) {
+  constexpr std::size_t kSize = 208;
+  constexpr std::size_t kBlocks = 8 * SlabPool::kBatch;
+
+  std::vector<void*> blocks;
+  for (std::size_t i = 0; i < kBlocks; ++i) {
+    blocks.push_back(SlabPool::allocate(kSize));
+  }
+  std::set<void*> allocated(blocks.begin(), blocks.end());
+
+  std::thread([&] {
+    for (auto* block : blocks) {
+      SlabPool::deallocate(block, kSize);
+    }
+  }).join();
+
+  // Keep what this thread still caches from the first slab aside, then only returned batches are left
+  std::vector<void*> cached;
+  while (true) {
+    auto* block = SlabPool::allocate(kSize);
+    cached.push_back(block);
+    if (allocated.count(block) != 0) {
+      break;
+    }
+    ASSERT_LT(cached.size(), 1024) << "Blocks freed by the other thread never came back";
+  }
+  for (auto* block : cached) {
+    SlabPool::deallocate(block, kSize);
+  }
+}
+
+TEST(SlabPoolTest, AllocatorWorksWithStandardContainers) {
+  auto value = std::allocate_shared<std::uint64_t>(SlabAllocator<std::uint64_t>{}, 42);
+  EXPECT_EQ(*value, 42);
+
+  std::vector<int, SlabAllocator<int>> values;
+  for (int i = 0; i < 1000; ++i) {
+    values.push_back(i);
+  }
+  EXPECT_EQ(values[999], 999);
+
+  struct alignas(64) Wide {
+    char bytes[64];
+  };
+  SlabAllocator<Wide> allocator;
+  auto* wide = allocator.allocate(1);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(wide) % 64, 0);
+  allocator.deallocate(wide, 1);
+}
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
 #include <future>
+#include <stdexcept>
+#include <thread>
 
 #include "src/http/threadpool/include/base.hpp"
 #include "src/http/threadpool/include/centralized_threadpool.hpp"
@@ -75,3 +79,76 @@ TEST(CentralizedThreadpoolTest, Destruction) {
 
   SUCCEED();
 }
+
+TEST(CentralizedThreadpoolTest, ScheduleAfter) {
+  auto pool = CentralizedThreadpool::create(std::move(Config(4, 16, "nyx")));
+
+  auto start = std::chrono::steady_clock::now();
+  auto late = pool->schedule_after(std::chrono::milliseconds(50), [](int value) { return value; }, 2);
+  auto early = pool->schedule_after(std::chrono::milliseconds(10), []() { return std::chrono::steady_clock::now(); });
+
+  auto early_at = early.get();
+  ASSERT_EQ(late.get(), 2);
+  auto late_at = std::chrono::steady_clock::now();
+
+  EXPECT_GE(early_at - start, std::chrono::milliseconds(10));
+  EXPECT_LT(early_at, late_at);
+  EXPECT_GE(late_at - start, std::chrono::milliseconds(50));
+}
+
+TEST(CentralizedThreadpoolTest, ScheduleEveryUntilCancelled) {
+  // A single worker runs the queue in order, the sentinel below finishes after every run queued before it
+  auto pool = CentralizedThreadpool::create(std::move(Config(1, 16, "nyx")));
+  std::atomic<int> runs{0};
+
+  auto id = pool->schedule_every(std::chrono::milliseconds(5), [&runs]() { runs.fetch_add(1); });
+  while (runs.load() < 5) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  ASSERT_TRUE(pool->cancel(id));
+  ASSERT_FALSE(pool->cancel(id));
+
+  // Runs already handed to the workers may still finish. The first sentinel waits out a timer callback that was
+  // in flight during cancel, the second one every run queued before it.
+  pool->schedule_after(std::chrono::milliseconds::zero(), []() {}).get();
+  pool->submit_task([]() {}).get();
+  auto after_cancel = runs.load();
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(runs.load(), after_cancel);
+}
+
+TEST(CentralizedThreadpoolTest, ExceptionReachesFuture) {
+  auto pool = CentralizedThreadpool::create(std::move(Config(2, 8, "nyx")));
+  auto future = pool->submit_task([]() -> int { throw std::runtime_error("task failed"); });
+
+  EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+TEST(CentralizedThreadpoolTest, TaskDroppedWhenQueueIsFull) {
+  auto pool = CentralizedThreadpool::create(std::move(Config(1, 1, "nyx")));
+  std::promise<void> release;
+  std::atomic<bool> started{false};
+
+  // Occupies the only worker, then a queued task fills the queue
+  auto blocking = pool->submit_task([&]() {
+    started.store(true);
+    release.get_future().wait();
+  });
+  while (!started.load()) {
+    std::this_thread::yield();
+  }
+  auto queued = pool->submit_task([]() { return 1; });
+  auto dropped = pool->submit_task([]() { return 2; });
+
+  try {
+    dropped.get();
+    FAIL() << "The queue had no room for the task";
+  } catch (const std::future_error& error) {
+    EXPECT_EQ(error.code(), std::future_errc::broken_promise);
+  }
+
+  release.set_value();
+  blocking.get();
+  EXPECT_EQ(queued.get(), 1);
+}